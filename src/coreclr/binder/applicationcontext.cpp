@@ -98,6 +98,17 @@ namespace BINDER_SPACE
 
         sTrustedPlatformAssemblies.Normalize();
 
+        // Size the map up front from the number of path separators so that applications with
+        // hundreds of TPA entries don't pay for repeated rehashing while the list is parsed.
+        {
+            COUNT_T tpaPathCount = 1;
+            for (SString::CIterator i = sTrustedPlatformAssemblies.Begin(); sTrustedPlatformAssemblies.Find(i, PATH_SEPARATOR_CHAR_W); ++i)
+            {
+                tpaPathCount++;
+            }
+            m_pTrustedPlatformAssemblyMap->Reallocate(tpaPathCount * 2);
+        }
+
         for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
         {
             SString fileName;
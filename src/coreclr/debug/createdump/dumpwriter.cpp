@@ -5,7 +5,8 @@
 
 DumpWriter::DumpWriter(CrashInfo& crashInfo) :
     m_fd(-1),
-    m_crashInfo(crashInfo)
+    m_crashInfo(crashInfo),
+    m_tempBuffer(new (std::nothrow) BYTE[TempBufferSize])
 {
     m_crashInfo.AddRef();
 }
@@ -23,6 +24,11 @@ DumpWriter::~DumpWriter()
 bool
 DumpWriter::OpenDump(const char* dumpFileName)
 {
+    if (m_tempBuffer == nullptr)
+    {
+        printf_error("Could not allocate the dump write buffer\n");
+        return false;
+    }
     m_fd = open(dumpFileName, O_WRONLY|O_CREAT|O_TRUNC, S_IWUSR | S_IRUSR);
     if (m_fd == -1)
     {
@@ -46,7 +52,7 @@ DumpWriter::WriteDiagInfo(size_t size)
         return false;
     }
     size_t alignment = size - sizeof(header);
-    assert(alignment < sizeof(m_tempBuffer));
+    assert(alignment < TempBufferSize);
     memset(m_tempBuffer, 0, alignment);
     if (!WriteData(m_tempBuffer, alignment)) {
         return false;
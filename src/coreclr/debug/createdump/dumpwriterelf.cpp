@@ -156,8 +156,8 @@ DumpWriter::WriteDump()
     // Zero out the end of the PT_NOTE section to the boundary
     // and then laydown the memory blocks
     if (finalNoteAlignment > 0) {
-        if (finalNoteAlignment > sizeof(m_tempBuffer)) {
-            printf_error("Internal error: finalNoteAlignment %zu > sizeof(m_tempBuffer)\n", finalNoteAlignment);
+        if (finalNoteAlignment > TempBufferSize) {
+            printf_error("Internal error: finalNoteAlignment %zu > TempBufferSize\n", finalNoteAlignment);
             return false;
         }
         memset(m_tempBuffer, 0, finalNoteAlignment);
@@ -186,7 +186,7 @@ DumpWriter::WriteDump()
         {
             while (size > 0)
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
+                size_t bytesToRead = std::min(size, (size_t)TempBufferSize);
                 size_t read = 0;
 
                 if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
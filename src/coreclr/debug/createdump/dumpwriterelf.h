@@ -42,7 +42,11 @@ class DumpWriter
 private:
     int m_fd;
     CrashInfo& m_crashInfo;
-    BYTE m_tempBuffer[0x4000];
+    // Large enough that copying big memory regions into the core file takes
+    // few process_vm_readv/write round trips per region. Allocated on the heap
+    // because the in-proc createdump runs on the small alternate signal stack.
+    static const size_t TempBufferSize = 0x40000;
+    ArrayHolder<BYTE> m_tempBuffer;
 
     // no public copy constructor
     DumpWriter(const DumpWriter&) = delete;
@@ -57,8 +57,8 @@ DumpWriter::WriteDump()
     // Write any segment alignment required to the core file
     if (alignment > 0)
     {
-        if (alignment > sizeof(m_tempBuffer)) {
-            printf_error("Internal error: segment alignment %llu > sizeof(m_tempBuffer)\n", alignment);
+        if (alignment > TempBufferSize) {
+            printf_error("Internal error: segment alignment %llu > TempBufferSize\n", alignment);
             return false;
         }
         memset(m_tempBuffer, 0, alignment);
@@ -265,7 +265,7 @@ DumpWriter::WriteSegments()
         {
             while (size > 0)
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
+                size_t bytesToRead = std::min(size, (size_t)TempBufferSize);
                 size_t read = 0;
 
                 if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
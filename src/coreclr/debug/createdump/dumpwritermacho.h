@@ -28,7 +28,8 @@ private:
 
     std::vector<segment_command_64> m_segmentLoadCommands;
     std::vector<ThreadCommand> m_threadLoadCommands;
-    BYTE m_tempBuffer[0x4000];
+    static const size_t TempBufferSize = 0x4000;
+    ArrayHolder<BYTE> m_tempBuffer;
 
     // no public copy constructor
     DumpWriter(const DumpWriter&) = delete;
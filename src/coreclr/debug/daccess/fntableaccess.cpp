@@ -59,6 +59,14 @@ static NTSTATUS OutOfProcessFindHeader(ReadMemoryFunction fpReadMemory,PVOID pUs
     // get DWORD and shift down our nibble
     //
     move(tmp, pMap);
+
+    // the DWORD lies entirely inside a code block and points at its start
+    if (IS_NIBBLE_MAP_POINTER(tmp))
+    {
+        codeHead = NIBBLE_MAP_POINTER2ADDR(tmp) - sizeof(CodeHeader);
+        return STATUS_SUCCESS;
+    }
+
     tmp = tmp >> POS2SHIFTCOUNT(startPos);
 
     // don't allow equality in the next check (tmp & NIBBLE_MASK == offset)
@@ -118,6 +126,11 @@ static NTSTATUS OutOfProcessFindHeader(ReadMemoryFunction fpReadMemory,PVOID pUs
         move (tmp, pMap);
     }
 
+    if (IS_NIBBLE_MAP_POINTER(tmp))
+    {
+        codeHead = NIBBLE_MAP_POINTER2ADDR(tmp) - sizeof(CodeHeader);
+        return STATUS_SUCCESS;
+    }
 
     while (!(tmp & NIBBLE_MASK))
     {
@@ -42,6 +42,9 @@ struct VirtualReserveFlags
     {
         None = 0,
         WriteWatch = 1,
+        // Ask the OS to back the range with huge pages where it can do so transparently.
+        // This is only a hint - if there aren't huge pages available we get normal pages.
+        TransparentHugePages = 2,
     };
 };
 
@@ -436,6 +439,14 @@ public:
     //  Any parameter can be null.
     static void GetMemoryStatus(uint64_t restricted_limit, uint32_t* memory_load, uint64_t* available_physical, uint64_t* available_page_file);
 
+    // Get memory pressure
+    // Parameters:
+    //  pressure - The percentage (0-100) of the last 10 seconds in which at least one task of the process'
+    //      memory cgroup (or of the whole system when not in one) was stalled waiting on memory.
+    // Return:
+    //  true if the OS reports memory pressure (Linux PSI), false otherwise.
+    static bool GetMemoryPressure(uint32_t* pressure);
+
     // Get size of an OS memory page
     static size_t GetPageSize();
 
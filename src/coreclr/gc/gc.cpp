@@ -18,12 +18,23 @@
 
 #include "gcpriv.h"
 
-#ifdef TARGET_AMD64
+// NativeAOT does not link the NEON vxsort library on ARM64 yet.
+#if defined(TARGET_AMD64) || (defined(TARGET_ARM64) && !defined(FEATURE_NATIVEAOT))
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
 #endif
 
+// SSE2 and AdvSIMD are part of the baseline ISA on these targets so the card scanner
+// can use them without checking what the processor supports.
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#define CARD_SCAN_SIMD
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#define CARD_SCAN_SIMD
+#endif
+
 #ifdef DACCESS_COMPILE
 #error this source file should not be compiled with DACCESS_COMPILE!
 #endif //DACCESS_COMPILE
@@ -1970,7 +1981,9 @@ const size_t low_latency_alloc = 256*1024;
 const size_t fgn_check_quantum = 2*1024*1024;
 
 #ifdef MH_SC_MARK
-const int max_snoop_level = 128;
+// When other GC threads are idle, keep this many objects available for them
+// to steal in our mark_steal_queue.
+const uint32_t mark_steal_share_count = 128;
 #endif //MH_SC_MARK
 
 #ifdef CARD_BUNDLE
@@ -2233,7 +2246,7 @@ void qsort1(uint8_t** low, uint8_t** high, unsigned int depth);
 #endif //USE_INTROSORT
 
 void* virtual_alloc (size_t size);
-void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node = NUMA_NODE_UNDEFINED);
+void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node = NUMA_NODE_UNDEFINED, bool use_transparent_huge_pages_p = false);
 
 /* per heap static initialization */
 #if defined(BACKGROUND_GC) && !defined(MULTIPLE_HEAPS)
@@ -2280,9 +2293,13 @@ size_t*     gc_heap::g_promoted;
 #endif //!USE_REGIONS || _DEBUG
 
 #ifdef MH_SC_MARK
-int*        gc_heap::g_mark_stack_busy;
+VOLATILE(int32_t) gc_heap::mark_steal_idle_count;
 #endif //MH_SC_MARK
 
+#ifdef BGC_UOH_SWEEP_STEALING
+VOLATILE(int32_t) gc_heap::bgc_uoh_sweep_heaps_remaining = 0;
+#endif //BGC_UOH_SWEEP_STEALING
+
 #ifdef BACKGROUND_GC
 size_t*     gc_heap::g_bpromoted;
 #endif //BACKGROUND_GC
@@ -2372,6 +2389,12 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
+uint64_t    gc_heap::pause_target_us = 0;
+float       gc_heap::pause_target_budget_factor = 1.0f;
+uint64_t    gc_heap::pause_target_smoothed_pause = 0;
+uint32_t    gc_heap::memory_pressure = 0;
+bool        gc_heap::memory_pressure_p = false;
+uint32_t    gc_heap::memory_pressure_th = 0;
 bool        gc_heap::spin_count_unit_config_p = false;
 
 uint64_t    gc_heap::suspended_start_time = 0;
@@ -2616,10 +2639,26 @@ size_t*     gc_heap::survived_per_region = nullptr;
 size_t*     gc_heap::old_card_survived_per_region = nullptr;
 #endif //USE_REGIONS
 
+#ifdef FEATURE_EVENT_TRACE
+live_type_stat* gc_heap::live_type_stats = nullptr;
+
+bool        gc_heap::live_type_stats_active_p = false;
+
+size_t      gc_heap::live_type_stats_dropped_size = 0;
+#endif //FEATURE_EVENT_TRACE
+
 BOOL        gc_heap::blocking_collection = FALSE;
 
 heap_segment* gc_heap::freeable_uoh_segment = 0;
 
+size_t      gc_heap::poh_frag_regions[POH_FRAG_BUCKETS];
+
+size_t      gc_heap::poh_frag_free_bytes = 0;
+
+size_t      gc_heap::poh_frag_used_bytes = 0;
+
+size_t      gc_heap::poh_frag_max_region_free = 0;
+
 uint64_t    gc_heap::time_bgc_last = 0;
 
 size_t      gc_heap::mark_stack_tos = 0;
@@ -2811,11 +2850,19 @@ size_t gc_heap::eph_gen_starts_size = 0;
 heap_segment* gc_heap::segment_standby_list;
 #endif //USE_REGIONS
 bool          gc_heap::use_large_pages_p = 0;
+bool          gc_heap::use_transparent_huge_pages_p = false;
+
+bool          gc_heap::adaptive_alloc_quantum_p = false;
+
+#ifdef FEATURE_EVENT_TRACE
+bool          gc_heap::live_type_stats_p = false;
+#endif //FEATURE_EVENT_TRACE
 #ifdef HEAP_BALANCE_INSTRUMENTATION
 size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
 #ifdef USE_REGIONS
 bool          gc_heap::enable_special_regions_p = false;
+int           gc_heap::gen2_compact_region_budget = 0;
 #else //USE_REGIONS
 size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_uoh_segment_size = 0;
@@ -2903,6 +2950,9 @@ uint8_t* gc_heap::alloc_allocated = 0;
 
 size_t gc_heap::allocation_quantum = CLR_SIZE;
 
+size_t gc_heap::alloc_quantum_grown_count = 0;
+size_t gc_heap::alloc_quantum_shrunk_count = 0;
+
 GCSpinLock gc_heap::more_space_lock_soh;
 GCSpinLock gc_heap::more_space_lock_uoh;
 
@@ -5654,7 +5704,7 @@ void* virtual_alloc (size_t size)
     return virtual_alloc(size, false);
 }
 
-void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node)
+void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node, bool use_transparent_huge_pages_p)
 {
     size_t requested_size = size;
 
@@ -5675,6 +5725,11 @@ void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node)
     }
 #endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
+    if (use_transparent_huge_pages_p)
+    {
+        flags |= VirtualReserveFlags::TransparentHugePages;
+    }
+
     void* prgmem = use_large_pages_p ?
         GCToOSInterface::VirtualReserveAndCommitLargePages(requested_size, numa_node) :
         GCToOSInterface::VirtualReserve(requested_size, card_size * card_word_width, flags, numa_node);
@@ -8371,22 +8426,11 @@ bool gc_heap::should_check_brick_for_reloc (uint8_t* o)
 }
 #endif //USE_REGIONS
 
-#ifdef MH_SC_MARK
-inline
-int& gc_heap::mark_stack_busy()
-{
-    return  g_mark_stack_busy [(heap_number+2)*HS_CACHE_LINE_SIZE/sizeof(int)];
-}
-#endif //MH_SC_MARK
-
 void gc_heap::make_mark_stack (mark* arr)
 {
     reset_pinned_queue();
     mark_stack_array = arr;
     mark_stack_array_length = MARK_STACK_INITIAL_LENGTH;
-#ifdef MH_SC_MARK
-    mark_stack_busy() = 0;
-#endif //MH_SC_MARK
 }
 
 #ifdef BACKGROUND_GC
@@ -9395,6 +9439,11 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
     }
 #endif //CARD_BUNDLE
 
+    if (use_transparent_huge_pages_p)
+    {
+        virtual_reserve_flags |= VirtualReserveFlags::TransparentHugePages;
+    }
+
     get_card_table_element_layout(start, end, card_table_element_layout);
 
     size_t alloc_size = card_table_element_layout[total_bookkeeping_elements];
@@ -9578,6 +9627,11 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
         }
 #endif //CARD_BUNDLE
 
+        if (use_transparent_huge_pages_p)
+        {
+            virtual_reserve_flags |= VirtualReserveFlags::TransparentHugePages;
+        }
+
         size_t alloc_size = card_table_element_layout[total_bookkeeping_elements];
         uint8_t* mem = (uint8_t*)GCToOSInterface::VirtualReserve (alloc_size, 0, virtual_reserve_flags);
 
@@ -10361,6 +10415,11 @@ private:
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+#ifdef TARGET_ARM64
+    // there's no downclocking to worry about with NEON, but below this threshold
+    // introsort is still as fast
+    const ptrdiff_t NEON_THRESHOLD_SIZE = 1024;
+#else //TARGET_ARM64
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const ptrdiff_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -10368,10 +10427,18 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     // above this threshold, using AVX512F for sorting will likely pay off
     // despite possible downclocking on current devices
     const ptrdiff_t AVX512F_THRESHOLD_SIZE = 128 * 1024;
+#endif //TARGET_ARM64
 
     if (item_count <= 1)
         return;
 
+#ifdef TARGET_ARM64
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+#else //TARGET_ARM64
     if (IsSupportedInstructionSet (InstructionSet::AVX2) && (item_count > AVX2_THRESHOLD_SIZE))
     {
         dprintf(3, ("Sorting mark lists"));
@@ -10386,6 +10453,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
             do_vxsort_avx2 (item_array, &item_array[item_count - 1], range_low, range_high);
         }
     }
+#endif //TARGET_ARM64
     else
     {
         dprintf (3, ("Sorting mark lists"));
@@ -11019,11 +11087,16 @@ void gc_heap::grow_mark_list ()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+    const bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::NEON);
+#else //TARGET_ARM64
+    const bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::AVX2);
+#endif //TARGET_ARM64
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -11906,6 +11979,15 @@ heap_segment* gc_heap::get_free_region (int gen_number, size_t size)
                            (region_end - region_start),
                            gen_number, true);
 
+#ifdef MULTIPLE_HEAPS
+        // A region with nothing committed gets committed on this heap's node as it grows, so
+        // it now belongs to this node rather than the one it was first made for.
+        if (heap_segment_committed (region) == heap_segment_mem (region))
+        {
+            heap_segment_numa_node (region) = heap_select::find_numa_node_from_heap_no (heap_number);
+        }
+#endif //MULTIPLE_HEAPS
+
         gc_oh_num oh = gen_to_oh (gen_number);
         dprintf(3, ("commit-accounting:  from free to %d [%p, %p) for heap %d", oh, get_region_start (region), heap_segment_committed (region), heap_number));
         {
@@ -12292,6 +12374,13 @@ heap_segment* gc_heap::make_heap_segment (uint8_t* new_pages, size_t size, gc_he
     heap_segment_used (new_segment) = start;
     heap_segment_reserved (new_segment) = new_pages + size;
     heap_segment_committed (new_segment) = new_pages + initial_commit;
+#ifdef USE_REGIONS
+#ifdef MULTIPLE_HEAPS
+    heap_segment_numa_node (new_segment) = heap_select::find_numa_node_from_heap_no (h_number);
+#else
+    heap_segment_numa_node (new_segment) = 0;
+#endif //MULTIPLE_HEAPS
+#endif //USE_REGIONS
 
     init_heap_segment (new_segment, hp
 #ifdef USE_REGIONS
@@ -12684,9 +12773,24 @@ void gc_heap::rearrange_heap_segments(BOOL compacting)
 #endif //!USE_REGIONS
 
 #if defined(USE_REGIONS)
-// trim down the list of free regions pointed at by free_list down to target_count, moving the extra ones to surplus_list
-static void remove_surplus_regions (region_free_list* free_list, region_free_list* surplus_list, size_t target_count)
+// trim down the list of free regions pointed at by free_list down to target_count, moving the extra ones to surplus_list.
+// Regions that are not on numa_node are moved first so the heap keeps the memory local to it.
+static void remove_surplus_regions (region_free_list* free_list, region_free_list* surplus_list, size_t target_count,
+                                    uint16_t numa_node)
 {
+    heap_segment* next_region = nullptr;
+    for (heap_segment* region = free_list->get_first_free_region();
+         (region != nullptr) && (free_list->get_num_free_regions() > target_count);
+         region = next_region)
+    {
+        next_region = heap_segment_next (region);
+        if (heap_segment_numa_node (region) != numa_node)
+        {
+            region_free_list::unlink_region (region);
+            surplus_list->add_region_front (region);
+        }
+    }
+
     while (free_list->get_num_free_regions() > target_count)
     {
         // remove one region from the heap's free list
@@ -12697,19 +12801,27 @@ static void remove_surplus_regions (region_free_list* free_list, region_free_lis
     }
 }
 
-// add regions from surplus_list to free_list, trying to reach target_count
-static int64_t add_regions (region_free_list* free_list, region_free_list* surplus_list, size_t target_count)
+// add regions from surplus_list to free_list, trying to reach target_count. If numa_node is specified
+// only regions on that node are taken.
+static int64_t add_regions (region_free_list* free_list, region_free_list* surplus_list, size_t target_count,
+                            uint16_t numa_node = NUMA_NODE_UNDEFINED)
 {
     int64_t added_count = 0;
-    while (free_list->get_num_free_regions() < target_count)
+    heap_segment* next_region = nullptr;
+    for (heap_segment* region = surplus_list->get_first_free_region();
+         (region != nullptr) && (free_list->get_num_free_regions() < target_count);
+         region = next_region)
     {
-        if (surplus_list->get_num_free_regions() == 0)
-            break;
+        next_region = heap_segment_next (region);
+        if ((numa_node != NUMA_NODE_UNDEFINED) && (heap_segment_numa_node (region) != numa_node))
+        {
+            continue;
+        }
 
         added_count++;
 
-        // remove one region from the surplus list
-        heap_segment* region = surplus_list->unlink_region_front();
+        // remove the region from the surplus list
+        region_free_list::unlink_region (region);
 
         // and put it on the heap's free list
         free_list->add_region_front (region);
@@ -13211,6 +13323,9 @@ void gc_heap::distribute_free_regions()
             break;
         }
     }
+    // With NUMA we try to keep free regions on heaps of the node they were committed on - memory on
+    // a remote node makes every allocation in it pay for cross node traffic.
+    bool numa_p = GCToOSInterface::CanEnableGCNumaAware();
 #else
     BOOL joined_last_gc_before_oom = last_gc_before_oom;
 #endif //MULTIPLE_HEAPS
@@ -13305,6 +13420,14 @@ void gc_heap::distribute_free_regions()
             {
                 next_region = heap_segment_next (region);
                 int age_in_free_to_decommit = min (max (AGE_IN_FREE_TO_DECOMMIT, n_heaps), MAX_AGE_IN_FREE);
+#ifdef MULTIPLE_HEAPS
+                // we'd rather get a remote region that stays unused decommitted sooner so when we need it
+                // again it gets recommitted on the right node.
+                if (numa_p && (heap_segment_numa_node (region) != heap_select::find_numa_node_from_heap_no (i)))
+                {
+                    age_in_free_to_decommit /= 2;
+                }
+#endif //MULTIPLE_HEAPS
                 // when we are about to get OOM, we'd like to discount the free regions that just have the initial page commit as they are not useful
                 if ((heap_segment_age_in_free (region) >= age_in_free_to_decommit) ||
                     ((get_region_committed_size (region) == GC_PAGE_SIZE) && joined_last_gc_before_oom))
@@ -13516,7 +13639,28 @@ void gc_heap::distribute_free_regions()
                     hp->free_regions[kind].get_num_free_regions(),
                     heap_budget_in_region_units[i][kind]));
 
-                remove_surplus_regions (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[i][kind]);
+                remove_surplus_regions (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[i][kind],
+                                        heap_select::find_numa_node_from_heap_no (i));
+            }
+        }
+        // give heaps having too few free regions the surplus regions on their own node first
+        if (numa_p)
+        {
+            for (int i = 0; i < n_heaps; i++)
+            {
+                gc_heap* hp = g_heaps[i];
+                if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[i][kind])
+                {
+                    int64_t num_added_regions = add_regions (&hp->free_regions[kind], &surplus_regions[kind],
+                                                             heap_budget_in_region_units[i][kind],
+                                                             heap_select::find_numa_node_from_heap_no (i));
+                    dprintf (REGIONS_LOG, ("added %zd local %s regions to heap %d - now has %zd, budget is %zd",
+                        (size_t)num_added_regions,
+                        kind_name[kind],
+                        i,
+                        hp->free_regions[kind].get_num_free_regions(),
+                        heap_budget_in_region_units[i][kind]));
+                }
             }
         }
         // finally go through all the heaps and distribute any surplus regions to heaps having too few free regions
@@ -14115,6 +14259,11 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 
     dprintf (1, ("conserve_mem_setting = %d", conserve_mem_setting));
 
+    pause_target_us = (uint64_t)GCConfig::GetGCPauseTargetMs() * 1000;
+    dprintf (1, ("pause_target_us = %zd", (size_t)pause_target_us));
+
+    memory_pressure_th = (uint32_t)min ((int64_t)GCConfig::GetGCMemoryPressureThreshold(), (int64_t)100);
+
 #ifdef WRITE_WATCH
     hardware_write_watch_api_supported();
 #ifdef BACKGROUND_GC
@@ -14174,7 +14323,8 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
         // Right now all the non mark array portions are commmitted since I'm calling make_card_table
         // on the whole range. This can be committed as needed.
         size_t reserve_size = regions_range;
-        uint8_t* reserve_range = (uint8_t*)virtual_alloc (reserve_size, use_large_pages_p);
+        uint8_t* reserve_range = (uint8_t*)virtual_alloc (reserve_size, use_large_pages_p, NUMA_NODE_UNDEFINED,
+                                                          use_transparent_huge_pages_p);
         if (!reserve_range)
             return E_OUTOFMEMORY;
 
@@ -14275,18 +14425,10 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
         return E_OUTOFMEMORY;
 #endif
 
-#ifdef MH_SC_MARK
-    g_mark_stack_busy = new (nothrow) int[(number_of_heaps+2)*HS_CACHE_LINE_SIZE/sizeof(int)];
-#endif //MH_SC_MARK
 #ifdef _PREFAST_
 #pragma warning(pop)
 #endif // _PREFAST_
 
-#ifdef MH_SC_MARK
-    if (!g_mark_stack_busy)
-        return E_OUTOFMEMORY;
-#endif //MH_SC_MARK
-
     if (!create_thread_support (number_of_heaps))
         return E_OUTOFMEMORY;
 
@@ -14806,6 +14948,8 @@ gc_heap::init_gc_heap (int h_number)
 
     freeable_uoh_segment = 0;
 
+    reset_poh_frag_stats();
+
     condemned_generation_num = 0;
 
     blocking_collection = FALSE;
@@ -14852,6 +14996,15 @@ gc_heap::init_gc_heap (int h_number)
 
     allocation_quantum = CLR_SIZE;
 
+    alloc_quantum_grown_count = 0;
+    alloc_quantum_shrunk_count = 0;
+
+#ifdef FEATURE_EVENT_TRACE
+    live_type_stats = nullptr;
+    live_type_stats_active_p = false;
+    live_type_stats_dropped_size = 0;
+#endif //FEATURE_EVENT_TRACE
+
     more_space_lock_soh = gc_lock;
 
     more_space_lock_uoh = gc_lock;
@@ -15216,6 +15369,13 @@ gc_heap::init_gc_heap (int h_number)
     current_sweep_seg = 0;
 #endif //DOUBLY_LINKED_FL
 
+#ifdef BGC_UOH_SWEEP_STEALING
+    bgc_uoh_sweep_items = 0;
+    bgc_uoh_sweep_item_count = 0;
+    bgc_uoh_sweep_helpers = 0;
+    bgc_uoh_sweep_item_index = 0;
+#endif //BGC_UOH_SWEEP_STEALING
+
 #endif //BACKGROUND_GC
 
 #ifdef GC_CONFIG_DRIVEN
@@ -16899,8 +17059,57 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
-size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+// alloc_context::alloc_quantum_info is laid out as -
+//
+// bits 24-31: signed scale (log2) applied to allocation_quantum for this context
+// bits 16-23: low 8 bits of the GC index the current sampling period started at
+// bits 0-15:  number of refills in the current sampling period (0 means never refilled)
+//
+// A period ends at the first refill after a GC. Contexts that were refilled many times
+// during it get a bigger quantum so they take more_space_lock_soh less often; contexts
+// that were barely refilled get a smaller one so they strand less gen0 space.
+#define ALLOC_QUANTUM_MIN_SCALE (-3)
+#define ALLOC_QUANTUM_MAX_SCALE (3)
+#define ALLOC_QUANTUM_HOT_REFILLS (64)
+#define ALLOC_QUANTUM_COLD_REFILLS (2)
+
+size_t gc_heap::get_alloc_quantum (alloc_context* acontext)
+{
+    if (!adaptive_alloc_quantum_p)
+    {
+        return allocation_quantum;
+    }
+
+    uint32_t info = acontext->alloc_quantum_info;
+    int scale = (int)(int8_t)(info >> 24);
+    uint32_t period_gc_index = (info >> 16) & 0xff;
+    uint32_t refills = info & 0xffff;
+    uint32_t current_gc_index = (uint32_t)(settings.gc_index & 0xff);
+
+    if ((refills != 0) && (period_gc_index != current_gc_index))
+    {
+        if ((refills >= ALLOC_QUANTUM_HOT_REFILLS) && (scale < ALLOC_QUANTUM_MAX_SCALE))
+        {
+            scale++;
+            alloc_quantum_grown_count++;
+        }
+        else if ((refills <= ALLOC_QUANTUM_COLD_REFILLS) && (scale > ALLOC_QUANTUM_MIN_SCALE))
+        {
+            scale--;
+            alloc_quantum_shrunk_count++;
+        }
+        refills = 0;
+    }
+
+    refills = min (refills + 1, (uint32_t)0xffff);
+    acontext->alloc_quantum_info = ((uint32_t)(uint8_t)scale << 24) | (current_gc_index << 16) | refills;
+
+    size_t quantum = ((scale >= 0) ? (allocation_quantum << scale) : (allocation_quantum >> (-scale)));
+    return Align (max (quantum, (size_t)1024), get_alignment_constant (TRUE));
+}
+
+size_t gc_heap::limit_from_size (size_t size, alloc_context* acontext, uint32_t flags, size_t physical_limit,
+                                 int gen_number, int align_const)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -16909,7 +17118,7 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? get_alloc_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -17271,7 +17480,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                 // We ask for more Align (min_obj_size)
                 // to make sure that we can insert a free object
                 // in adjust_limit will set the limit lower
-                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
+                size_t limit = limit_from_size (size, acontext, flags, free_list_size, gen_number, align_const);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
                 uint8_t*  remain = (free_list + limit);
@@ -17437,6 +17646,12 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
     {
         uint8_t* free_list = allocator->alloc_list_head_of (a_l_idx);
         uint8_t* prev_free_item = 0;
+
+        // POH free space never gets compacted away so for POH we take the tightest fit in
+        // this bucket instead of the first one.
+        uint8_t* best_fit_item = ((gen_number == poh_generation) ?
+                                  find_best_fit_poh (allocator, a_l_idx, size, align_const) : 0);
+
         while (free_list != 0)
         {
             dprintf (3, ("considering free list %zx", (size_t)free_list));
@@ -17450,7 +17665,8 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
 #endif //FEATURE_LOH_COMPACTION
 
             // must fit exactly or leave formattable space
-            if ((diff == 0) || (diff >= (ptrdiff_t)Align (min_obj_size, align_const)))
+            if (((best_fit_item == 0) || (free_list == best_fit_item)) &&
+                ((diff == 0) || (diff >= (ptrdiff_t)Align (min_obj_size, align_const))))
             {
 #ifdef BACKGROUND_GC
 #ifdef MULTIPLE_HEAPS
@@ -17465,7 +17681,7 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
                 remove_gen_free (gen_number, free_list_size);
 
                 // Subtract min obj size because limit_from_size adds it. Not needed for LOH
-                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
+                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), acontext, flags, free_list_size,
                                                 gen_number, align_const);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
@@ -17527,6 +17743,45 @@ exit:
     return can_fit;
 }
 
+// Looks at up to max_poh_fit_candidates free items in this bucket that can hold size and
+// returns the smallest one, or 0 if nothing in the bucket fits. Items within a bucket can
+// differ by up to 2x so first fit can split a large item when a smaller one further down
+// would have done, and on POH that split is never undone by compaction.
+uint8_t* gc_heap::find_best_fit_poh (allocator* poh_allocator,
+                                     unsigned int a_l_idx,
+                                     size_t size,
+                                     int align_const)
+{
+    const int max_poh_fit_candidates = 64;
+    uint8_t* best_fit_item = 0;
+    size_t best_fit_size = 0;
+    int candidates = 0;
+
+    for (uint8_t* free_list = poh_allocator->alloc_list_head_of (a_l_idx);
+         free_list != 0; free_list = free_list_slot (free_list))
+    {
+        size_t free_list_size = unused_array_size (free_list);
+        ptrdiff_t diff = free_list_size - size;
+
+        if ((diff == 0) || (diff >= (ptrdiff_t)Align (min_obj_size, align_const)))
+        {
+            if ((best_fit_item == 0) || (free_list_size < best_fit_size))
+            {
+                best_fit_item = free_list;
+                best_fit_size = free_list_size;
+            }
+
+            if ((diff == 0) || (++candidates >= max_poh_fit_candidates))
+            {
+                break;
+            }
+        }
+    }
+
+    dprintf (3, ("POH best fit for %zd in bucket %d: %p(%zd)", size, a_l_idx, best_fit_item, best_fit_size));
+    return best_fit_item;
+}
+
 BOOL gc_heap::a_fit_segment_end_p (int gen_number,
                                    heap_segment* seg,
                                    size_t size,
@@ -17561,6 +17816,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     if (a_size_fit_p (size, allocated, end, align_const))
     {
         limit = limit_from_size (size,
+                                 acontext,
                                  flags,
                                  (end - allocated),
                                  gen_number, align_const);
@@ -17572,6 +17828,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     if ((heap_segment_reserved (seg) != heap_segment_committed (seg)) && (a_size_fit_p (size, allocated, end, align_const)))
     {
         limit = limit_from_size (size,
+                                 acontext,
                                  flags,
                                  (end - allocated),
                                  gen_number, align_const);
@@ -22465,8 +22722,11 @@ void gc_heap::gc1()
             allocation_quantum = Align (min ((size_t)CLR_SIZE,
                                             (size_t)max ((size_t)1024, get_new_allocation (0) / (2 * alloc_contexts_used))),
                                             get_alignment_constant(FALSE));
-            dprintf (3, ("New allocation quantum: %zd(0x%zx)", allocation_quantum, allocation_quantum));
+            dprintf (3, ("New allocation quantum: %zd(0x%zx), %zd contexts grew and %zd shrank theirs since last GC",
+                allocation_quantum, allocation_quantum, alloc_quantum_grown_count, alloc_quantum_shrunk_count));
         }
+        alloc_quantum_grown_count = 0;
+        alloc_quantum_shrunk_count = 0;
     }
 #ifdef USE_REGIONS
     if (end_gen0_region_space == uninitialized_end_gen0_region_space)
@@ -25628,6 +25888,26 @@ void gc_heap::calculate_new_heap_count ()
         }
     }
 
+    if ((pause_target_us != 0) && process_eph_samples_p)
+    {
+        // The tcp based decision doesn't know about the pause target. If we are already running with the
+        // smallest budget and still pausing longer than the target, more heaps is what's left to try; and
+        // we shouldn't take heaps away when that'd likely push the pauses over the target.
+        uint64_t median_pause = (uint64_t)median_of_3 ((float)dynamic_heap_count_data.samples[0].gc_pause_time,
+                                                       (float)dynamic_heap_count_data.samples[1].gc_pause_time,
+                                                       (float)dynamic_heap_count_data.samples[2].gc_pause_time);
+        if ((median_pause > pause_target_us) && (new_n_heaps <= n_heaps) && (pause_target_budget_factor <= (1.0f / 8.0f)))
+        {
+            new_n_heaps = min ((n_heaps + max (1, (n_heaps / 4))), actual_n_max_heaps);
+            dprintf (6666, ("median pause %I64d > target %I64d, inc %d -> %d", median_pause, pause_target_us, n_heaps, new_n_heaps));
+        }
+        else if ((new_n_heaps < n_heaps) && ((median_pause * 2) > pause_target_us))
+        {
+            dprintf (6666, ("median pause %I64d close to target %I64d, keeping %d heaps instead of %d", median_pause, pause_target_us, n_heaps, new_n_heaps));
+            new_n_heaps = n_heaps;
+        }
+    }
+
     assert (new_n_heaps >= 1);
     assert (new_n_heaps <= actual_n_max_heaps);
 #endif //STRESS_DYNAMIC_HEAP_COUNT
@@ -26312,6 +26592,13 @@ void gc_heap::add_to_promoted_bytes (uint8_t* object, size_t obj_size, int threa
     }
 #endif //USE_REGIONS
 
+#ifdef FEATURE_EVENT_TRACE
+    if (live_type_stats_active_p)
+    {
+        record_live_type (object, obj_size);
+    }
+#endif //FEATURE_EVENT_TRACE
+
 #if !defined(USE_REGIONS) || defined(_DEBUG)
 #ifdef MULTIPLE_HEAPS
     g_promoted [heap_number*16] += obj_size;
@@ -26326,6 +26613,98 @@ void gc_heap::add_to_promoted_bytes (uint8_t* object, size_t obj_size, int threa
 #endif //_DEBUG
 }
 
+#ifdef FEATURE_EVENT_TRACE
+// Only full blocking GCs mark everything that's live, so those are the only ones whose
+// per type totals mean anything; ephemeral GCs and BGCs leave the table alone.
+void gc_heap::init_live_type_stats (int condemned_gen_number)
+{
+    live_type_stats_active_p = false;
+
+    if (!live_type_stats_p || (condemned_gen_number != max_generation))
+    {
+        return;
+    }
+
+    if (live_type_stats == nullptr)
+    {
+        live_type_stats = new (nothrow) live_type_stat[LIVE_TYPE_STATS_TABLE_SIZE];
+        if (live_type_stats == nullptr)
+        {
+            dprintf (2, ("h%d failed to allocate the live type stats table", heap_number));
+            return;
+        }
+    }
+
+    memset (live_type_stats, 0, sizeof (live_type_stat) * LIVE_TYPE_STATS_TABLE_SIZE);
+    live_type_stats_dropped_size = 0;
+    live_type_stats_active_p = true;
+}
+
+// Under segments UOH objects report as max_generation, as object_gennum does.
+void gc_heap::record_live_type (uint8_t* object, size_t obj_size)
+{
+    MethodTable* mt = (MethodTable*)method_table (object);
+    int gen_number = object_gennum (object);
+    assert ((gen_number >= 0) && (gen_number < total_generation_count));
+
+    size_t index = (((size_t)mt >> 3) * 0x9E3779B9) & (LIVE_TYPE_STATS_TABLE_SIZE - 1);
+    for (int probe = 0; probe < LIVE_TYPE_STATS_MAX_PROBES; probe++)
+    {
+        live_type_stat* stat = &live_type_stats[index];
+        if (stat->mt == nullptr)
+        {
+            stat->mt = mt;
+        }
+
+        if (stat->mt == mt)
+        {
+            stat->count++;
+            stat->size[gen_number] += obj_size;
+            return;
+        }
+
+        index = (index + 1) & (LIVE_TYPE_STATS_TABLE_SIZE - 1);
+    }
+
+    live_type_stats_dropped_size += obj_size;
+}
+
+// Fires one LiveTypeStats event per type this heap marked, followed by one with a null MT
+// carrying the bytes that didn't fit in the table. Consumers sum across heaps and resolve
+// the MTs with the type load/rundown events.
+void gc_heap::fire_live_type_stats_events()
+{
+    size_t types = 0;
+    for (size_t i = 0; i < LIVE_TYPE_STATS_TABLE_SIZE; i++)
+    {
+        live_type_stat* stat = &live_type_stats[i];
+        if (stat->mt == nullptr)
+        {
+            continue;
+        }
+
+        types++;
+        GCEventFireLiveTypeStats_V1 (
+            (uint16_t)heap_number,
+            (uint64_t)settings.gc_index,
+            (uint64_t)stat->mt,
+            (uint64_t)stat->count,
+            (uint64_t)stat->size[0],
+            (uint64_t)stat->size[1],
+            (uint64_t)stat->size[max_generation],
+            (uint64_t)stat->size[loh_generation],
+            (uint64_t)stat->size[poh_generation]
+        );
+    }
+
+    GCEventFireLiveTypeStats_V1 ((uint16_t)heap_number, (uint64_t)settings.gc_index,
+        (uint64_t)0, (uint64_t)0, (uint64_t)0, (uint64_t)0, (uint64_t)live_type_stats_dropped_size, (uint64_t)0, (uint64_t)0);
+
+    dprintf (2, ("h%d live type stats: %zd types, %zd bytes dropped", heap_number, types, live_type_stats_dropped_size));
+    live_type_stats_active_p = false;
+}
+#endif //FEATURE_EVENT_TRACE
+
 heap_segment* gc_heap::find_segment (uint8_t* interior, BOOL small_segment_only_p)
 {
     heap_segment* seg = seg_mapping_table_segment_of (interior);
@@ -26886,15 +27265,6 @@ inline void Prefetch (void* addr)
     UNREFERENCED_PARAMETER(addr);
 }
 #endif //PREFETCH
-#ifdef MH_SC_MARK
-inline
-VOLATILE(uint8_t*)& gc_heap::ref_mark_stack (gc_heap* hp, int index)
-{
-    return ((VOLATILE(uint8_t*)*)(hp->mark_stack_array))[index];
-}
-
-#endif //MH_SC_MARK
-
 #define stolen 2
 #define partial 1
 #define partial_object 3
@@ -27055,13 +27425,103 @@ void mark_queue_t::verify_empty()
 #endif //MARK_PHASE_PREFETCH
 }
 
+#ifdef MH_SC_MARK
+mark_steal_deque::mark_steal_deque()
+    : top(0), bottom(0)
+{
+    for (uint32_t i = 0; i < slot_count; i++)
+    {
+        slot_table[i] = nullptr;
+    }
+}
+
+// Only called by the owning heap. Returns false when the deque is full.
+inline
+bool mark_steal_deque::push (uint8_t* o)
+{
+    uint32_t b = bottom;
+    uint32_t t = top;
+    if ((int32_t)(b - t) >= (int32_t)slot_count)
+    {
+        return false;
+    }
+
+    slot_table[b & (slot_count - 1)] = o;
+    // the object needs to be visible before the thieves can see the new bottom.
+    bottom = b + 1;
+    return true;
+}
+
+// Only called by the owning heap. Returns nullptr when the deque is empty.
+inline
+uint8_t* mark_steal_deque::pop()
+{
+    uint32_t b = bottom - 1;
+    bottom = b;
+    // the store to bottom must be visible before we read top, otherwise we and
+    // a thief could both take the last object.
+    MemoryBarrier();
+    uint32_t t = top;
+
+    int32_t n = (int32_t)(b - t);
+    if (n < 0)
+    {
+        // empty
+        bottom = t;
+        return nullptr;
+    }
+
+    uint8_t* o = slot_table[b & (slot_count - 1)];
+    if (n > 0)
+    {
+        return o;
+    }
+
+    // this is the last object, race against the thieves for it.
+    if (Interlocked::CompareExchange (&top, t + 1, t) != t)
+    {
+        o = nullptr;
+    }
+    bottom = t + 1;
+    return o;
+}
+
+// Called by other heaps. Returns nullptr when the deque is empty or when we
+// lost the race for the top object to another thief or the owner.
+uint8_t* mark_steal_deque::steal()
+{
+    uint32_t t = top;
+    MemoryBarrier();
+    uint32_t b = bottom;
+
+    if ((int32_t)(b - t) <= 0)
+    {
+        return nullptr;
+    }
+
+    // If the owner wrapped around and reused this slot, top must have moved past t
+    // already and the interlocked operation below fails.
+    uint8_t* o = slot_table[t & (slot_count - 1)];
+    if (Interlocked::CompareExchange (&top, t + 1, t) != t)
+    {
+        return nullptr;
+    }
+    return o;
+}
+
+void mark_steal_deque::verify_empty()
+{
+    assert (count() == 0);
+}
+#endif //MH_SC_MARK
+
 void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL)
 {
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_tos = (SERVER_SC_MARK_VOLATILE(uint8_t*)*)mark_stack_array;
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_limit = (SERVER_SC_MARK_VOLATILE(uint8_t*)*)&mark_stack_array[mark_stack_array_length];
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_base = mark_stack_tos;
+    uint8_t** mark_stack_tos = (uint8_t**)mark_stack_array;
+    uint8_t** mark_stack_limit = (uint8_t**)&mark_stack_array[mark_stack_array_length];
+    uint8_t** mark_stack_base = mark_stack_tos;
 #ifdef SORT_MARK_STACK
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* sorted_tos = mark_stack_base;
+    uint8_t** sorted_tos = mark_stack_base;
 #endif //SORT_MARK_STACK
 
     // If we are doing a full GC we don't use mark list anyway so use m_boundary_fullgc that doesn't
@@ -27076,9 +27536,13 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
 
     assert ((start >= oo) && (start < oo+size(oo)));
 
-#ifndef MH_SC_MARK
+#ifdef MH_SC_MARK
+    // Whether we should hand some of the objects we discover to other GC threads
+    // that are idle. This is refreshed every time we pop an object.
+    BOOL share_p = FALSE;
+#endif //MH_SC_MARK
+
     *mark_stack_tos = oo;
-#endif //!MH_SC_MARK
 
     while (1)
     {
@@ -27087,15 +27551,10 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
         const int thread = 0;
 #endif //MULTIPLE_HEAPS
 
-        if (oo && ((size_t)oo != 4))
+        if (oo)
         {
             size_t s = 0;
-            if (stolen_p (oo))
-            {
-                --mark_stack_tos;
-                goto next_level;
-            }
-            else if (!partial_p (oo) && ((s = size (oo)) < (partial_size_th*sizeof (uint8_t*))))
+            if (!partial_p (oo) && ((s = size (oo)) < (partial_size_th*sizeof (uint8_t*))))
             {
                 BOOL overflow_p = FALSE;
 
@@ -27128,7 +27587,12 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                                   add_to_promoted_bytes (o, thread);
                                                   if (contain_pointers_or_collectible (o))
                                                   {
-                                                      *(mark_stack_tos++) = o;
+#ifdef MH_SC_MARK
+                                                      if (!(share_p && mark_steal_queue.push (o)))
+#endif //MH_SC_MARK
+                                                      {
+                                                          *(mark_stack_tos++) = o;
+                                                      }
                                                   }
                                               }
                                           }
@@ -27199,12 +27663,8 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                     dprintf(3,("pushing mark for %zx ", (size_t)oo));
 
                     //push the object and its current
-                    SERVER_SC_MARK_VOLATILE(uint8_t*)* place = ++mark_stack_tos;
+                    uint8_t** place = ++mark_stack_tos;
                     mark_stack_tos++;
-#ifdef MH_SC_MARK
-                    *(place-1) = 0;
-                    *(place) = (uint8_t*)partial;
-#endif //MH_SC_MARK
                     int i = num_partial_refs;
                     uint8_t* ref_to_continue = 0;
 
@@ -27225,7 +27685,12 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                                 add_to_promoted_bytes (o, thread);
                                                 if (contain_pointers_or_collectible (o))
                                                 {
-                                                    *(mark_stack_tos++) = o;
+#ifdef MH_SC_MARK
+                                                    if (!(share_p && mark_steal_queue.push (o)))
+#endif //MH_SC_MARK
+                                                    {
+                                                        *(mark_stack_tos++) = o;
+                                                    }
                                                     if (--i == 0)
                                                     {
                                                         ref_to_continue = (uint8_t*)((size_t)(ppslot+1) | partial);
@@ -27239,11 +27704,7 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                         );
                     //we are finished with this object
                     assert (ref_to_continue == 0);
-#ifdef MH_SC_MARK
-                    assert ((*(place-1)) == (uint8_t*)0);
-#else //MH_SC_MARK
                     *(place-1) = 0;
-#endif //MH_SC_MARK
                     *place = 0;
                     // shouldn't we decrease tos by 2 here??
 
@@ -27251,11 +27712,6 @@ more_to_do:
                     if (ref_to_continue)
                     {
                         //update the start
-#ifdef MH_SC_MARK
-                        assert ((*(place-1)) == (uint8_t*)0);
-                        *(place-1) = (uint8_t*)((size_t)oo | partial_object);
-                        assert (((*place) == (uint8_t*)1) || ((*place) == (uint8_t*)2));
-#endif //MH_SC_MARK
                         *place = ref_to_continue;
                     }
                 }
@@ -27284,8 +27740,22 @@ more_to_do:
             sorted_tos = min ((size_t)sorted_tos, (size_t)mark_stack_tos);
 #endif //SORT_MARK_STACK
         }
+#ifdef MH_SC_MARK
+        else if ((oo = mark_steal_queue.pop()) != nullptr)
+        {
+            // our own mark stack is empty, continue with what we shared but
+            // nobody has stolen yet.
+            start = oo;
+            *mark_stack_tos = oo;
+        }
+#endif //MH_SC_MARK
         else
             break;
+
+#ifdef MH_SC_MARK
+        int32_t idle_count = mark_steal_idle_count;
+        share_p = ((idle_count != 0) && (idle_count != n_heaps) && (mark_steal_queue.count() < mark_steal_share_count));
+#endif //MH_SC_MARK
     }
 }
 
@@ -27295,224 +27765,96 @@ BOOL same_numa_node_p (int hn1, int hn2)
     return (heap_select::find_numa_node_from_heap_no (hn1) == heap_select::find_numa_node_from_heap_no (hn2));
 }
 
-int find_next_buddy_heap (int this_heap_number, int current_buddy, int n_heaps)
+// Find a heap that has objects available in its mark_steal_queue. Heaps on our
+// own NUMA node are preferred, we only steal from remote heaps when there's nothing
+// to steal locally.
+gc_heap* gc_heap::find_mark_steal_victim()
 {
-    int hn = (current_buddy+1)%n_heaps;
-    while (hn != current_buddy)
+    for (int local_pass = 1; local_pass >= 0; local_pass--)
     {
-        if ((this_heap_number != hn) && (same_numa_node_p (this_heap_number, hn)))
-            return hn;
-        hn = (hn+1)%n_heaps;
+        for (int i = 1; i < n_heaps; i++)
+        {
+            int hn = (heap_number + i) % n_heaps;
+            if ((same_numa_node_p (heap_number, hn) ? 1 : 0) != local_pass)
+            {
+                continue;
+            }
+
+            gc_heap* hp = g_heaps[hn];
+            if (hp->mark_steal_queue.count() != 0)
+            {
+                return hp;
+            }
+        }
     }
-    return current_buddy;
+
+    return nullptr;
 }
 
+// Called by a GC thread that's finished marking from its own roots. While other
+// GC threads are still busy we steal objects they've shared in their mark_steal_queue
+// and mark through them. We are done when every GC thread has become idle which also
+// means all mark_steal_queues are empty - a queue is only ever pushed to by its owner
+// while the owner is busy, and a thread always decrements the idle count *before*
+// it attempts to steal so no thread can observe everybody being idle while someone is
+// still holding an object it took from a queue.
 void
 gc_heap::mark_steal()
 {
-    mark_stack_busy() = 0;
-    //clear the mark stack in the snooping range
-    for (int i = 0; i < max_snoop_level; i++)
-    {
-        ((VOLATILE(uint8_t*)*)(mark_stack_array))[i] = 0;
-    }
+    dprintf (SNOOP_LOG, ("(GC%d)heap%d: start stealing", settings.gc_index, heap_number));
 
-    //pick the next heap as our buddy
-    int thpn = find_next_buddy_heap (heap_number, heap_number, n_heaps);
-
-#ifdef SNOOP_STATS
-        dprintf (SNOOP_LOG, ("(GC%d)heap%d: start snooping %d", settings.gc_index, heap_number, (heap_number+1)%n_heaps));
-        uint64_t begin_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
-#endif //SNOOP_STATS
+    Interlocked::Increment (&mark_steal_idle_count);
 
     int idle_loop_count = 0;
-    int first_not_ready_level = 0;
-
     while (1)
     {
-        gc_heap* hp = g_heaps [thpn];
-        int level = first_not_ready_level;
-        first_not_ready_level = 0;
-
-        while (check_next_mark_stack (hp) && (level < (max_snoop_level-1)))
+        gc_heap* hp = find_mark_steal_victim();
+        if (hp != nullptr)
         {
-            idle_loop_count = 0;
-#ifdef SNOOP_STATS
-            snoop_stat.busy_count++;
-            dprintf (SNOOP_LOG, ("heap%d: looking at next heap level %d stack contents: %zx",
-                                 heap_number, level, (int)((uint8_t**)(hp->mark_stack_array))[level]));
-#endif //SNOOP_STATS
-
-            uint8_t* o = ref_mark_stack (hp, level);
+            Interlocked::Decrement (&mark_steal_idle_count);
 
-            uint8_t* start = o;
-            if (ref_p (o))
+            uint8_t* o = hp->mark_steal_queue.steal();
+            if (o != nullptr)
             {
-                mark_stack_busy() = 1;
-
-                BOOL success = TRUE;
-                uint8_t* next = (ref_mark_stack (hp, level+1));
-                if (ref_p (next))
-                {
-                    if (((size_t)o > 4) && !partial_object_p (o))
-                    {
-                        //this is a normal object, not a partial mark tuple
-                        //success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level), 0, o)==o);
-                        success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level), (uint8_t*)4, o)==o);
+                dprintf (SNOOP_LOG, ("heap%d: stole %zx from heap%d", heap_number, (size_t)o, hp->heap_number));
 #ifdef SNOOP_STATS
-                        snoop_stat.interlocked_count++;
-                        if (success)
-                            snoop_stat.normal_count++;
+                snoop_stat.stolen_entry_count++;
 #endif //SNOOP_STATS
-                    }
-                    else
-                    {
-                        //it is a stolen entry, or beginning/ending of a partial mark
-                        level++;
-#ifdef SNOOP_STATS
-                        snoop_stat.stolen_or_pm_count++;
-#endif //SNOOP_STATS
-                        success = FALSE;
-                    }
-                }
-                else if (stolen_p (next))
-                {
-                    //ignore the stolen guy and go to the next level
-                    success = FALSE;
-                    level+=2;
-#ifdef SNOOP_STATS
-                    snoop_stat.stolen_entry_count++;
-#endif //SNOOP_STATS
-                }
-                else
-                {
-                    assert (partial_p (next));
-                    start = ref_from_slot (next);
-                    //re-read the object
-                    o = ref_from_slot (ref_mark_stack (hp, level));
-                    if (o && start)
-                    {
-                        //steal the object
-                        success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level+1),
-                                                                        (uint8_t*)stolen, next) == next);
-#ifdef SNOOP_STATS
-                        snoop_stat.interlocked_count++;
-                        if (success)
-                        {
-                            snoop_stat.partial_mark_parent_count++;
-                        }
-#endif //SNOOP_STATS
-                    }
-                    else
-                    {
-                        // stack is not ready, or o is completely different from the last time we read from this stack level.
-                        // go up 2 levels to steal children or totally unrelated objects.
-                        success = FALSE;
-                        if (first_not_ready_level == 0)
-                        {
-                            first_not_ready_level = level;
-                        }
-                        level+=2;
-#ifdef SNOOP_STATS
-                        snoop_stat.pm_not_ready_count++;
-#endif //SNOOP_STATS
-                    }
-                }
-                if (success)
-                {
-
-#ifdef SNOOP_STATS
-                    dprintf (SNOOP_LOG, ("heap%d: marking %zx from %d [%d] tl:%dms",
-                            heap_number, (size_t)o, (heap_number+1)%n_heaps, level,
-                            (GCToOSInterface::GetLowPrecisionTimeStamp()-begin_tick)));
-                    uint64_t start_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
-#endif //SNOOP_STATS
-
-                    mark_object_simple1 (o, start, heap_number);
-
-#ifdef SNOOP_STATS
-                    dprintf (SNOOP_LOG, ("heap%d: done marking %zx from %d [%d] %dms tl:%dms",
-                            heap_number, (size_t)o, (heap_number+1)%n_heaps, level,
-                            (GCToOSInterface::GetLowPrecisionTimeStamp()-start_tick),(GCToOSInterface::GetLowPrecisionTimeStamp()-begin_tick)));
-#endif //SNOOP_STATS
-
-                    mark_stack_busy() = 0;
-
-                    //clear the mark stack in snooping range
-                    for (int i = 0; i < max_snoop_level; i++)
-                    {
-                        if (((uint8_t**)mark_stack_array)[i] != 0)
-                        {
-                            ((VOLATILE(uint8_t*)*)(mark_stack_array))[i] = 0;
-#ifdef SNOOP_STATS
-                            snoop_stat.stack_bottom_clear_count++;
-#endif //SNOOP_STATS
-                        }
-                    }
-
-                    level = 0;
-                }
-                mark_stack_busy() = 0;
+                idle_loop_count = 0;
+                mark_object_simple1 (o, o, heap_number);
+                // we need to be completely out of work, including whatever is still
+                // sitting in the prefetch queue, before we can become idle again.
+                drain_mark_queue();
             }
-            else
-            {
-                //slot is either partial or stolen
-                level++;
-            }
-        }
-        if ((first_not_ready_level != 0) && hp->mark_stack_busy())
-        {
-            continue;
+
+            Interlocked::Increment (&mark_steal_idle_count);
         }
-        if (!hp->mark_stack_busy())
+        else
         {
-            first_not_ready_level = 0;
-            idle_loop_count++;
-
-            if ((idle_loop_count % (6) )==1)
+            if (mark_steal_idle_count == n_heaps)
             {
-#ifdef SNOOP_STATS
-                snoop_stat.switch_to_thread_count++;
-#endif //SNOOP_STATS
-                GCToOSInterface::Sleep(1);
+                break;
             }
-            int free_count = 1;
+
 #ifdef SNOOP_STATS
             snoop_stat.stack_idle_count++;
-            //dprintf (SNOOP_LOG, ("heap%d: counting idle threads", heap_number));
 #endif //SNOOP_STATS
-            for (int hpn = (heap_number+1)%n_heaps; hpn != heap_number;)
+            idle_loop_count++;
+            if ((idle_loop_count % 64) == 0)
             {
-                if (!((g_heaps [hpn])->mark_stack_busy()))
-                {
-                    free_count++;
 #ifdef SNOOP_STATS
-                dprintf (SNOOP_LOG, ("heap%d: %d idle", heap_number, free_count));
+                snoop_stat.switch_to_thread_count++;
 #endif //SNOOP_STATS
-                }
-                else if (same_numa_node_p (hpn, heap_number) || ((idle_loop_count%1000))==999)
-                {
-                    thpn = hpn;
-                    break;
-                }
-                hpn = (hpn+1)%n_heaps;
-                YieldProcessor();
+                GCToOSInterface::YieldThread (0);
             }
-            if (free_count == n_heaps)
+            else
             {
-                break;
+                YieldProcessor();
             }
         }
     }
-}
 
-inline
-BOOL gc_heap::check_next_mark_stack (gc_heap* next_heap)
-{
-#ifdef SNOOP_STATS
-    snoop_stat.check_level_count++;
-#endif //SNOOP_STATS
-    return (next_heap->mark_stack_busy()>=1);
+    dprintf (SNOOP_LOG, ("(GC%d)heap%d: done stealing", settings.gc_index, heap_number));
 }
 #endif //MH_SC_MARK
 
@@ -29291,6 +29633,10 @@ void gc_heap::mark_phase (int condemned_gen_number)
     dprintf (2, (ThreadStressLog::gcStartMarkMsg(), heap_number, condemned_gen_number));
     BOOL  full_p = (condemned_gen_number == max_generation);
 
+#ifdef FEATURE_EVENT_TRACE
+    init_live_type_stats (condemned_gen_number);
+#endif //FEATURE_EVENT_TRACE
+
     int gen_to_init = condemned_gen_number;
     if (condemned_gen_number == max_generation)
     {
@@ -29335,19 +29681,6 @@ void gc_heap::mark_phase (int condemned_gen_number)
     snoop_stat.heap_index = heap_number;
 #endif //SNOOP_STATS
 
-#ifdef MH_SC_MARK
-    if (full_p)
-    {
-        //initialize the mark stack
-        for (int i = 0; i < max_snoop_level; i++)
-        {
-            ((uint8_t**)(mark_stack_array))[i] = 0;
-        }
-
-        mark_stack_busy() = 1;
-    }
-#endif //MH_SC_MARK
-
     static uint32_t num_sizedrefs = 0;
 
 #ifdef MH_SC_MARK
@@ -29451,6 +29784,8 @@ void gc_heap::mark_phase (int condemned_gen_number)
         {
             do_mark_steal_p = FALSE;
         }
+
+        mark_steal_idle_count = 0;
 #endif //MH_SC_MARK
 
         gc_t_join.restart();
@@ -29933,6 +30268,16 @@ void gc_heap::mark_phase (int condemned_gen_number)
     finalization_promoted_bytes = total_promoted_bytes - promoted_bytes_live;
 
     mark_queue.verify_empty();
+#ifdef MH_SC_MARK
+    mark_steal_queue.verify_empty();
+#endif //MH_SC_MARK
+
+#ifdef FEATURE_EVENT_TRACE
+    if (live_type_stats_active_p)
+    {
+        fire_live_type_stats_events();
+    }
+#endif //FEATURE_EVENT_TRACE
 
     dprintf(2,("---- End of mark phase ----"));
 }
@@ -32386,6 +32731,13 @@ void gc_heap::plan_phase (int condemned_gen_number)
     memset (planned_regions_per_gen, 0, sizeof (planned_regions_per_gen));
     memset (sip_maxgen_regions_per_gen, 0, sizeof (sip_maxgen_regions_per_gen));
     memset (reserved_free_regions_sip, 0, sizeof (reserved_free_regions_sip));
+    gen2_compact_budget_p = (gen2_compact_region_budget > 0) &&
+                            (condemned_gen_number == max_generation) &&
+                            (settings.reason != reason_induced_aggressive);
+    if (gen2_compact_budget_p)
+    {
+        init_gen2_compact_region_budget();
+    }
     int pinned_survived_region = 0;
     uint8_t** mark_list_index = nullptr;
     uint8_t** mark_list_next = nullptr;
@@ -34729,20 +35081,61 @@ void gc_heap::update_start_tail_regions (generation* gen,
 //
 // This new region we get needs to be temporarily recorded instead of being on the free_regions list because
 // we can't use it for other purposes.
+//
+// With a gen2 compact region budget we bound how much a compacting gen2 GC copies - a heavily fragmented
+// heap then gets compacted over several gen2 GCs instead of in one long pause. We bucket gen2 regions by
+// their survival ratio and evacuate the sparsest ones up to the budget; all other gen2 regions are swept
+// in plan.
+void gc_heap::init_gen2_compact_region_budget()
+{
+    const int max_surv_ratio = 100;
+    int regions_per_surv_ratio[max_surv_ratio + 1];
+    memset (regions_per_surv_ratio, 0, sizeof (regions_per_surv_ratio));
+
+    size_t basic_region_size = (size_t)1 << min_segment_size_shr;
+    heap_segment* region = heap_segment_rw (generation_start_segment (generation_of (max_generation)));
+    while (region)
+    {
+        int surv_ratio = (int)(((double)heap_segment_survived (region) * 100.0) / (double)basic_region_size);
+        regions_per_surv_ratio[min (surv_ratio, max_surv_ratio)]++;
+        region = heap_segment_next_rw (region);
+    }
+
+    int total_regions = 0;
+    gen2_compact_surv_ratio_th = max_surv_ratio;
+    for (int i = 0; i <= max_surv_ratio; i++)
+    {
+        total_regions += regions_per_surv_ratio[i];
+        if (total_regions >= gen2_compact_region_budget)
+        {
+            gen2_compact_surv_ratio_th = i;
+            break;
+        }
+    }
+
+    gen2_compact_regions_left = gen2_compact_region_budget;
+
+    dprintf (REGIONS_LOG, ("h%d gen2 compact budget %d regions, evacuating regions with surv <= %d%%",
+        heap_number, gen2_compact_region_budget, gen2_compact_surv_ratio_th));
+}
+
 inline
 bool gc_heap::should_sweep_in_plan (heap_segment* region)
 {
-    if (!enable_special_regions_p)
+    if (settings.reason == reason_induced_aggressive)
     {
         return false;
     }
 
-    if (settings.reason == reason_induced_aggressive)
+    int gen_num = get_region_gen_num (region);
+    bool budget_p = gen2_compact_budget_p && (gen_num == max_generation);
+
+    if (!enable_special_regions_p && !budget_p)
     {
         return false;
     }
+
     bool sip_p = false;
-    int gen_num = get_region_gen_num (region);
     int new_gen_num = get_plan_gen_num (gen_num);
     heap_segment_swept_in_plan (region) = false;
 
@@ -34778,7 +35171,19 @@ bool gc_heap::should_sweep_in_plan (heap_segment* region)
             heap_segment_survived (region),
             basic_region_size,
             surv_ratio, sip_surv_ratio_th));
-        if (surv_ratio >= sip_surv_ratio_th)
+        if (budget_p)
+        {
+            if ((surv_ratio <= gen2_compact_surv_ratio_th) && (gen2_compact_regions_left > 0))
+            {
+                gen2_compact_regions_left--;
+            }
+            else
+            {
+                set_region_plan_gen_num (region, new_gen_num);
+                sip_p = true;
+            }
+        }
+        else if (surv_ratio >= sip_surv_ratio_th)
         {
             set_region_plan_gen_num (region, new_gen_num);
             sip_p = true;
@@ -40790,6 +41195,42 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Returns the first non-zero word in [word, word_end[, or word_end if they're all 0.
+// Used to skip over the clear parts of the card table and the card bundle table which,
+// for ephemeral GCs, is most of it on large heaps.
+inline
+uint32_t* find_nonzero_card_word (uint32_t* word, uint32_t* word_end)
+{
+#ifdef CARD_SCAN_SIMD
+    // Check 8 words (256 bits) at a time; the scalar loop below then finds the exact word.
+    while ((word_end - word) >= 8)
+    {
+#if defined(TARGET_AMD64)
+        __m128i v = _mm_or_si128 (_mm_loadu_si128 ((const __m128i*)word),
+                                  _mm_loadu_si128 ((const __m128i*)(word + 4)));
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi8 (v, _mm_setzero_si128 ())) != 0xFFFF)
+        {
+            break;
+        }
+#else //TARGET_AMD64
+        uint32x4_t v = vorrq_u32 (vld1q_u32 (word), vld1q_u32 (word + 4));
+        if (vmaxvq_u32 (v) != 0)
+        {
+            break;
+        }
+#endif //TARGET_AMD64
+        word += 8;
+    }
+#endif //CARD_SCAN_SIMD
+
+    while ((word < word_end) && !(*word))
+    {
+        word++;
+    }
+
+    return word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -40807,6 +41248,19 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             // Find a non-zero bundle
             while (cardb < end_cardb)
             {
+                if (card_bundle_bit (cardb) == 0)
+                {
+                    // Skip whole bundle words that are clear.
+                    uint32_t* cbw_start = &card_bundle_table[card_bundle_word (cardb)];
+                    uint32_t* cbw_end = &card_bundle_table[card_bundle_word (end_cardb)];
+                    uint32_t* cbw_found = find_nonzero_card_word (cbw_start, cbw_end);
+                    cardb += (cbw_found - cbw_start) * card_bundle_word_width;
+                    if (cardb >= end_cardb)
+                    {
+                        break;
+                    }
+                }
+
                 uint32_t cbw = card_bundle_table[card_bundle_word(cardb)] >> card_bundle_bit (cardb);
                 DWORD bit_index;
                 if (BitScanForward (&bit_index, cbw))
@@ -40824,10 +41278,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_nonzero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -40841,10 +41292,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_nonzero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -40864,15 +41312,11 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
-        while (card_word < card_word_end)
+        card_word = find_nonzero_card_word (card_word, card_word_end);
+        if (card_word < card_word_end)
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -40932,12 +41376,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_nonzero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -40985,6 +41424,10 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 
     end_card = (last_card_word - &card_table [0])* card_word_width + bit_position;
 
+    // The caller is about to look at the objects under these cards; start bringing them in
+    // while it finds the first object via the brick table.
+    Prefetch (card_address (card));
+
     //dprintf (3, ("find_card: [%zx, %zx[ set", card, end_card));
     dprintf (3, ("fc: [%zx, %zx[", card, end_card));
     return TRUE;
@@ -43451,6 +43894,22 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
             new_allocation = linear_allocation_model (allocation_fraction, new_allocation,
                                                       dd_desired_allocation (dd), time_since_previous_collection_secs);
 
+            if ((gen_number == 0) && memory_pressure_p)
+            {
+                size_t new_allocation_for_pressure = max (new_allocation / 2, min_gc_size);
+                dprintf (2, ("h%d gen0 budget %zd -> %zd for memory pressure %d%%",
+                    heap_number, new_allocation, new_allocation_for_pressure, memory_pressure));
+                new_allocation = new_allocation_for_pressure;
+            }
+
+            if (pause_target_us != 0)
+            {
+                size_t new_allocation_for_pause = (size_t) min (max ((size_t)(new_allocation * pause_target_budget_factor), min_gc_size), max_size);
+                dprintf (2, ("h%d gen%d budget %zd -> %zd for pause target (factor %.3f)",
+                    heap_number, gen_number, new_allocation, new_allocation_for_pause, pause_target_budget_factor));
+                new_allocation = new_allocation_for_pause;
+            }
+
 #ifdef DYNAMIC_HEAP_COUNT
             if (dynamic_adaptation_mode != dynamic_adaptation_to_application_sizes)
 #endif //DYNAMIC_HEAP_COUNT
@@ -44056,7 +44515,11 @@ bool gc_heap::decommit_step (uint64_t step_milliseconds)
     size_t decommit_size = 0;
 
 #ifdef USE_REGIONS
-    const size_t max_decommit_step_size = DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds;
+    update_memory_pressure();
+
+    // Under memory pressure getting the memory back to the OS matters more than the cost of
+    // recommitting it later, so don't pace decommitting free regions.
+    const size_t max_decommit_step_size = (memory_pressure_p ? SIZE_T_MAX : (DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds));
     for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
     {
         dprintf (REGIONS_LOG, ("decommit_step %d, regions_to_decommit = %zd",
@@ -45642,6 +46105,245 @@ void gc_heap::background_ephemeral_sweep()
     generation_allocator (youngest_gen)->copy_with_no_repair (&youngest_free_list);
 }
 
+#ifdef BGC_UOH_SWEEP_STEALING
+// Called by the owning BGC thread once UOH allocations are blocked, so the UOH region lists
+// can't change until this heap is done sweeping them.
+void gc_heap::publish_bgc_uoh_sweep_items()
+{
+    assert (bgc_uoh_sweep_items == 0);
+    bgc_uoh_sweep_item_index = 0;
+
+    int count = 0;
+    for (int i = uoh_start_generation; i < total_generation_count; i++)
+    {
+        for (heap_segment* seg = heap_segment_rw (generation_start_segment (generation_of (i)));
+             seg != 0; seg = heap_segment_next_rw (seg))
+        {
+            // Regions of 4GB or more would need their gaps split into several free objects; we
+            // leave those to the owner.
+            size_t used_size = heap_segment_allocated (seg) - heap_segment_mem (seg);
+            if ((heap_segment_background_allocated (seg) != 0) && (used_size > 0) && (used_size < UINT32_MAX))
+            {
+                count++;
+            }
+        }
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    bgc_uoh_sweep_item* items = new (nothrow) bgc_uoh_sweep_item[count];
+    if (!items)
+    {
+        dprintf (2, ("h%d couldn't allocate %d UOH sweep items, sweeping UOH by itself", heap_number, count));
+        return;
+    }
+
+    int item_index = 0;
+    for (int i = uoh_start_generation; i < total_generation_count; i++)
+    {
+        for (heap_segment* seg = heap_segment_rw (generation_start_segment (generation_of (i)));
+             seg != 0; seg = heap_segment_next_rw (seg))
+        {
+            size_t used_size = heap_segment_allocated (seg) - heap_segment_mem (seg);
+            if ((heap_segment_background_allocated (seg) != 0) && (used_size > 0) && (used_size < UINT32_MAX))
+            {
+                bgc_uoh_sweep_item* item = &items[item_index++];
+                item->seg = seg;
+                item->plug_end = 0;
+                item->gap_list = 0;
+                item->free_size = 0;
+                item->state = bgc_uoh_sweep_unclaimed;
+            }
+        }
+    }
+    assert (item_index == count);
+
+    bgc_uoh_sweep_items = items;
+    Interlocked::Exchange (&bgc_uoh_sweep_item_count, count);
+    dprintf (2, ("h%d published %d UOH regions for sweeping", heap_number, count));
+}
+
+void gc_heap::retire_bgc_uoh_sweep_items()
+{
+    if (bgc_uoh_sweep_items)
+    {
+        Interlocked::Exchange (&bgc_uoh_sweep_item_count, 0);
+
+        // A helper could have read the count before we reset it.
+        while (VolatileLoad (&bgc_uoh_sweep_helpers) != 0)
+        {
+            allow_fgc();
+            YieldProcessor();
+        }
+
+        delete[] bgc_uoh_sweep_items;
+        bgc_uoh_sweep_items = 0;
+    }
+
+    Interlocked::Decrement (&bgc_uoh_sweep_heaps_remaining);
+}
+
+// Runs on whichever BGC thread claimed the item, which is usually not the owner of the region.
+// This only reads the mark bits and turns the gaps into free objects - the mark bits stay set
+// so an FGC still sees the right liveness for this region until the owner takes it over.
+void gc_heap::bgc_sweep_uoh_item (bgc_uoh_sweep_item* item)
+{
+    heap_segment* seg = item->seg;
+    int align_const = get_alignment_constant (FALSE);
+    const int num_objs = 256;
+    int current_num_objs = 0;
+
+    uint8_t* o = heap_segment_mem (seg);
+    uint8_t* end = heap_segment_allocated (seg);
+    uint8_t* plug_end = o;
+    uint8_t* gap_tail = 0;
+    size_t free_size = 0;
+
+    dprintf (3, ("h%d sweeping UOH region %p [%p, %p[ for h%d", heap_number, seg, o, end,
+        heap_segment_heap (seg)->heap_number));
+
+    while (o < end)
+    {
+        if (background_object_marked (o, FALSE))
+        {
+            uint8_t* plug_start = o;
+            size_t gap_size = plug_start - plug_end;
+            if (gap_size > 0)
+            {
+                make_unused_array (plug_end, gap_size);
+                free_list_slot (plug_end) = 0;
+                if (gap_tail)
+                {
+                    free_list_slot (gap_tail) = plug_end;
+                }
+                else
+                {
+                    item->gap_list = plug_end;
+                }
+                gap_tail = plug_end;
+                free_size += gap_size;
+            }
+
+            do
+            {
+                o = o + Align (size (o), align_const);
+            } while ((o < end) && background_object_marked (o, FALSE));
+
+            plug_end = o;
+        }
+
+        while ((o < end) && !background_object_marked (o, FALSE))
+        {
+            o = o + Align (size (o), align_const);
+
+            if (++current_num_objs >= num_objs)
+            {
+                allow_fgc();
+                current_num_objs = 0;
+            }
+        }
+    }
+
+    item->plug_end = plug_end;
+    item->free_size = free_size;
+    VolatileStore (&item->state, (int32_t)bgc_uoh_sweep_done);
+}
+
+// Called by the owner for each UOH region it's about to sweep. Returns FALSE if the owner
+// should sweep seg itself; otherwise the region was swept by another BGC thread and its gaps
+// have now been threaded onto the owner's free list.
+BOOL gc_heap::bgc_take_swept_uoh_region (heap_segment* seg, generation* gen,
+                                         uint8_t** plug_end, size_t* free_size)
+{
+    if ((bgc_uoh_sweep_item_index >= bgc_uoh_sweep_item_count) ||
+        (bgc_uoh_sweep_items[bgc_uoh_sweep_item_index].seg != seg))
+    {
+        return FALSE;
+    }
+
+    bgc_uoh_sweep_item* item = &bgc_uoh_sweep_items[bgc_uoh_sweep_item_index++];
+    if (Interlocked::CompareExchange (&item->state, (int32_t)bgc_uoh_sweep_claimed, (int32_t)bgc_uoh_sweep_unclaimed) ==
+        bgc_uoh_sweep_unclaimed)
+    {
+        return FALSE;
+    }
+
+    while (VolatileLoad (&item->state) != bgc_uoh_sweep_done)
+    {
+        allow_fgc();
+        YieldProcessor();
+    }
+
+    // No FGC can come in between here and when we mark seg as swept; moving the sweep pos to
+    // the end first means nothing on seg needs its mark bit past this point.
+    uint8_t* end = heap_segment_allocated (seg);
+    current_sweep_pos = end;
+    bgc_clear_batch_mark_array_bits (heap_segment_mem (seg), end);
+
+    uint8_t* gap = item->gap_list;
+    while (gap)
+    {
+        uint8_t* next_gap = free_list_slot (gap);
+        size_t gap_size = unused_array_size (gap);
+        free_list_slot (gap) = 0;
+        dprintf (2, ("uoh fr: [%p-%p[(%zd)", gap, (gap + gap_size), gap_size));
+        thread_gap (gap, gap_size, gen);
+        gap = next_gap;
+    }
+
+    *plug_end = item->plug_end;
+    *free_size = item->free_size;
+    return TRUE;
+}
+
+// Called by a BGC thread that's done sweeping its own heap. Until every heap has finished
+// its UOH sweep it keeps sweeping UOH regions other heaps have published but not started on.
+void gc_heap::help_bgc_uoh_sweep()
+{
+    while (VolatileLoad (&bgc_uoh_sweep_heaps_remaining) > 0)
+    {
+        bool found_work_p = false;
+
+        for (int n = 1; n < n_heaps; n++)
+        {
+            gc_heap* hp = g_heaps[(heap_number + n) % n_heaps];
+            if (VolatileLoad (&hp->bgc_uoh_sweep_item_count) == 0)
+            {
+                continue;
+            }
+
+            Interlocked::Increment (&hp->bgc_uoh_sweep_helpers);
+            int count = VolatileLoad (&hp->bgc_uoh_sweep_item_count);
+
+            // The owner goes front to back so we go back to front to stay out of its way.
+            for (int j = count - 1; j >= 0; j--)
+            {
+                bgc_uoh_sweep_item* item = &hp->bgc_uoh_sweep_items[j];
+                if ((VolatileLoad (&item->state) == bgc_uoh_sweep_unclaimed) &&
+                    (Interlocked::CompareExchange (&item->state, (int32_t)bgc_uoh_sweep_claimed, (int32_t)bgc_uoh_sweep_unclaimed) ==
+                     bgc_uoh_sweep_unclaimed))
+                {
+                    bgc_sweep_uoh_item (item);
+                    found_work_p = true;
+                }
+            }
+
+            Interlocked::Decrement (&hp->bgc_uoh_sweep_helpers);
+        }
+
+        if (!found_work_p)
+        {
+            enable_preemptive ();
+            GCToOSInterface::Sleep (1);
+            disable_preemptive (true);
+        }
+    }
+}
+#endif //BGC_UOH_SWEEP_STEALING
+
 void gc_heap::background_sweep()
 {
     //concurrent_print_time_delta ("finished with mark and start with sweep");
@@ -45755,6 +46457,10 @@ void gc_heap::background_sweep()
 
         leave_spin_lock (&gc_lock);
 
+#ifdef BGC_UOH_SWEEP_STEALING
+        bgc_uoh_sweep_heaps_remaining = n_heaps;
+#endif //BGC_UOH_SWEEP_STEALING
+
 #ifdef MULTIPLE_HEAPS
         dprintf(2, ("Starting BGC threads for BGC sweeping"));
         bgc_t_join.restart();
@@ -45809,6 +46515,11 @@ void gc_heap::background_sweep()
                 generation_allocation_pointer (gen)= 0;
                 generation_allocation_limit (gen) = 0;
                 generation_allocation_segment (gen) = heap_segment_rw (generation_start_segment (gen));
+
+                if (i == poh_generation)
+                {
+                    reset_poh_frag_stats();
+                }
             }
             else
             {
@@ -45855,6 +46566,9 @@ void gc_heap::background_sweep()
             // on a seg is unmarked, we will process this in process_background_segment_end.
             size_t free_obj_size_last_gap = 0;
 
+            // Total size of the gaps between POH survivors on this seg, for the POH frag stats.
+            size_t poh_seg_free_size = 0;
+
             allow_fgc();
             uint8_t* end = background_next_end (seg, (i > max_generation));
             dprintf (3333, ("bgs: seg: %zx, [%zx, %zx[%zx", (size_t)seg,
@@ -45862,6 +46576,13 @@ void gc_heap::background_sweep()
                             (size_t)heap_segment_allocated (seg),
                             (size_t)heap_segment_background_allocated (seg)));
 
+#ifdef BGC_UOH_SWEEP_STEALING
+            if ((i > max_generation) && bgc_take_swept_uoh_region (seg, gen, &plug_end, &poh_seg_free_size))
+            {
+                o = end;
+            }
+#endif //BGC_UOH_SWEEP_STEALING
+
             while (o < end)
             {
                 if (background_object_marked (o, TRUE))
@@ -45873,6 +46594,10 @@ void gc_heap::background_sweep()
                     }
 
                     thread_gap (plug_end, plug_start-plug_end, gen);
+                    if (i == poh_generation)
+                    {
+                        poh_seg_free_size += plug_start - plug_end;
+                    }
                     if (i == max_generation)
                     {
                         add_gen_free (max_generation, plug_start-plug_end);
@@ -46029,6 +46754,11 @@ void gc_heap::background_sweep()
                 dprintf (2, ("seg %p (%p) has been swept", seg, heap_segment_mem (seg)));
                 seg->flags |= heap_segment_flags_swept;
                 current_sweep_pos = end;
+
+                if (i == poh_generation)
+                {
+                    record_poh_region_frag (seg, poh_seg_free_size);
+                }
             }
 
             verify_soh_segment_list();
@@ -46052,6 +46782,11 @@ void gc_heap::background_sweep()
         generation_allocation_segment (gen) = heap_segment_rw (generation_start_segment (gen));
         PREFIX_ASSUME(generation_allocation_segment(gen) != NULL);
 
+        if (i == poh_generation)
+        {
+            fire_poh_frag_event();
+        }
+
         if (i == max_generation)
         {
             dprintf (2, ("bgs: sweeping uoh objects"));
@@ -46072,9 +46807,18 @@ void gc_heap::background_sweep()
             }
 
             current_bgc_state = bgc_sweep_uoh;
+
+#ifdef BGC_UOH_SWEEP_STEALING
+            publish_bgc_uoh_sweep_items();
+#endif //BGC_UOH_SWEEP_STEALING
         }
     }
 
+#ifdef BGC_UOH_SWEEP_STEALING
+    retire_bgc_uoh_sweep_items();
+    help_bgc_uoh_sweep();
+#endif //BGC_UOH_SWEEP_STEALING
+
     size_t total_soh_size = generation_sizes (generation_of (max_generation));
     size_t total_loh_size = generation_size (loh_generation);
     size_t total_poh_size = generation_size (poh_generation);
@@ -46195,6 +46939,13 @@ void gc_heap::sweep_uoh_objects (int gen_num)
     generation_free_obj_space (gen) = 0;
     generation_free_list_allocated (gen) = 0;
 
+    bool poh_p = (gen_num == poh_generation);
+    size_t seg_free_size = 0;
+    if (poh_p)
+    {
+        reset_poh_frag_stats();
+    }
+
     dprintf (3, ("sweeping uoh objects"));
     dprintf (3, ("seg: %zx, [%zx, %zx[, starting from %p",
                  (size_t)seg,
@@ -46231,9 +46982,14 @@ void gc_heap::sweep_uoh_objects (int gen_num)
                     heap_segment_allocated (seg) = plug_end;
                     decommit_heap_segment_pages (seg, 0);
                 }
+                if (poh_p)
+                {
+                    record_poh_region_frag (seg, seg_free_size);
+                }
                 prev_seg = seg;
             }
             seg = next_seg;
+            seg_free_size = 0;
             if (seg == 0)
                 break;
             else
@@ -46253,6 +47009,7 @@ void gc_heap::sweep_uoh_objects (int gen_num)
             plug_start = o;
             //everything between plug_end and plug_start is free
             thread_gap (plug_end, plug_start-plug_end, gen);
+            seg_free_size += plug_start - plug_end;
 
             BOOL m = TRUE;
             while (m)
@@ -46279,6 +47036,55 @@ void gc_heap::sweep_uoh_objects (int gen_num)
     generation_allocation_segment (gen) = heap_segment_rw (generation_start_segment (gen));
 
     PREFIX_ASSUME(generation_allocation_segment(gen) != NULL);
+
+    if (poh_p)
+    {
+        fire_poh_frag_event();
+    }
+}
+
+void gc_heap::reset_poh_frag_stats()
+{
+    memset (poh_frag_regions, 0, sizeof (poh_frag_regions));
+    poh_frag_free_bytes = 0;
+    poh_frag_used_bytes = 0;
+    poh_frag_max_region_free = 0;
+}
+
+// free_size is the total size of the gaps between surviving objects on seg; the space
+// after the last survivor has already been trimmed off so it doesn't count.
+void gc_heap::record_poh_region_frag (heap_segment* seg, size_t free_size)
+{
+    size_t used_size = heap_segment_allocated (seg) - heap_segment_mem (seg);
+    assert (free_size <= used_size);
+
+    int bucket = (used_size == 0) ? 0 : (int)((free_size * POH_FRAG_BUCKETS) / used_size);
+    poh_frag_regions[min (bucket, (POH_FRAG_BUCKETS - 1))]++;
+    poh_frag_free_bytes += free_size;
+    poh_frag_used_bytes += used_size;
+    poh_frag_max_region_free = max (poh_frag_max_region_free, free_size);
+
+    dprintf (3, ("h%d POH region %p: %zd free of %zd used", heap_number, heap_segment_mem (seg), free_size, used_size));
+}
+
+void gc_heap::fire_poh_frag_event()
+{
+    dprintf (2, ("h%d POH frag: %zd free / %zd used, max region free %zd, regions by free%%: %zd/%zd/%zd/%zd",
+        heap_number, poh_frag_free_bytes, poh_frag_used_bytes, poh_frag_max_region_free,
+        poh_frag_regions[0], poh_frag_regions[1], poh_frag_regions[2], poh_frag_regions[3]));
+
+#ifdef FEATURE_EVENT_TRACE
+    GCEventFirePOHFragmentation_V1 (
+        (uint16_t)heap_number,
+        (uint64_t)poh_frag_free_bytes,
+        (uint64_t)poh_frag_used_bytes,
+        (uint64_t)poh_frag_max_region_free,
+        (uint32_t)poh_frag_regions[0],
+        (uint32_t)poh_frag_regions[1],
+        (uint32_t)poh_frag_regions[2],
+        (uint32_t)poh_frag_regions[3]
+    );
+#endif //FEATURE_EVENT_TRACE
 }
 
 void gc_heap::relocate_in_uoh_objects (int gen_num)
@@ -48318,6 +49124,11 @@ HRESULT GCHeap::Initialize()
         return CLR_E_GC_LARGE_PAGE_MISSING_HARD_LIMIT;
     }
     GCConfig::SetGCLargePages(gc_heap::use_large_pages_p);
+    gc_heap::use_transparent_huge_pages_p = !gc_heap::use_large_pages_p && GCConfig::GetGCTransparentHugePages();
+    gc_heap::adaptive_alloc_quantum_p = GCConfig::GetGCAdaptiveAllocQuantum();
+#ifdef FEATURE_EVENT_TRACE
+    gc_heap::live_type_stats_p = GCConfig::GetGCLiveTypeStats();
+#endif //FEATURE_EVENT_TRACE
 
 #ifdef USE_REGIONS
     gc_heap::regions_range = (size_t)GCConfig::GetGCRegionRange();
@@ -48399,6 +49210,7 @@ HRESULT GCHeap::Initialize()
 
 #ifdef USE_REGIONS
     gc_heap::enable_special_regions_p = (bool)GCConfig::GetGCEnableSpecialRegions();
+    gc_heap::gen2_compact_region_budget = (int)max ((int64_t)0, GCConfig::GetGCGen2CompactRegionBudget());
     size_t gc_region_size = (size_t)GCConfig::GetGCRegionSize();
 
     if (gc_region_size >= MAX_REGION_SIZE)
@@ -49806,10 +50618,45 @@ last_recorded_gc_info* gc_heap::get_completed_bgc_info()
 }
 #endif //BACKGROUND_GC
 
+// Called at the start of every GC and every decommit step so we both react and relax
+// without waiting for the next GC.
+void gc_heap::update_memory_pressure()
+{
+    if (memory_pressure_th == 0)
+    {
+        return;
+    }
+
+    uint32_t pressure = 0;
+    if (!GCToOSInterface::GetMemoryPressure (&pressure))
+    {
+        return;
+    }
+
+    memory_pressure = pressure;
+    bool was_under_pressure_p = memory_pressure_p;
+    if (pressure >= memory_pressure_th)
+    {
+        memory_pressure_p = true;
+    }
+    else if (pressure < (memory_pressure_th / 2))
+    {
+        memory_pressure_p = false;
+    }
+
+    if (memory_pressure_p != was_under_pressure_p)
+    {
+        dprintf (1, ("memory pressure %d%% (th %d%%) -> %s", pressure, memory_pressure_th,
+            (memory_pressure_p ? "reacting" : "relaxed")));
+    }
+}
+
 void gc_heap::do_pre_gc()
 {
     STRESS_LOG_GC_STACK;
 
+    update_memory_pressure();
+
 #ifdef STRESS_LOG
     STRESS_LOG_GC_START(VolatileLoad(&settings.gc_index),
                         (uint32_t)settings.condemned_generation,
@@ -50209,6 +51056,37 @@ void gc_heap::update_recorded_gen_data (last_recorded_gc_info* gc_info)
     }
 }
 
+// Adjusts the factor we scale the ephemeral budgets by so the ephemeral pauses stay under
+// pause_target_us. Ephemeral GC work is mostly proportional to what survives, which for
+// request/response style workloads grows with the budget, so we shrink the budget right
+// away when a GC goes over the target and only grow it slowly when there's headroom which
+// makes GCs less frequent.
+void gc_heap::update_pause_target_budget_factor (uint64_t pause_duration)
+{
+    const float min_factor = 1.0f / 16.0f;
+    const float max_factor = 4.0f;
+
+    pause_target_smoothed_pause = ((pause_target_smoothed_pause == 0) ? pause_duration :
+                                   ((pause_target_smoothed_pause * 3 + pause_duration) / 4));
+
+    float old_factor = pause_target_budget_factor;
+    if (pause_duration > pause_target_us)
+    {
+        // Don't cut by more than half at a time since one outlier shouldn't drop the budget to the floor.
+        pause_target_budget_factor *= max (0.5f, (float)pause_target_us / (float)pause_duration);
+    }
+    else if (pause_target_smoothed_pause < (pause_target_us / 2))
+    {
+        pause_target_budget_factor *= 1.1f;
+    }
+
+    pause_target_budget_factor = min (max (pause_target_budget_factor, min_factor), max_factor);
+
+    dprintf (2, ("GC#%zd pause %zdus (smoothed %zdus) target %zdus, budget factor %.3f -> %.3f",
+        (size_t)settings.gc_index, (size_t)pause_duration, (size_t)pause_target_smoothed_pause,
+        (size_t)pause_target_us, old_factor, pause_target_budget_factor));
+}
+
 void gc_heap::do_post_gc()
 {
 #ifdef MULTIPLE_HEAPS
@@ -50327,6 +51205,11 @@ void gc_heap::do_post_gc()
         last_gc_info->pause_durations[0] = pause_duration;
         total_suspended_time += pause_duration;
         last_gc_info->pause_durations[1] = 0;
+
+        if ((pause_target_us != 0) && (settings.condemned_generation < max_generation))
+        {
+            update_pause_target_budget_factor (pause_duration);
+        }
     }
 
     uint64_t total_process_time = end_gc_time - process_start_time;
@@ -51225,6 +52108,25 @@ Object* GCHeap::GetNextFinalizableObject()
 
 }
 
+Object* GCHeap::GetNextNonCriticalFinalizable(int start_heap)
+{
+#ifdef MULTIPLE_HEAPS
+    int n = gc_heap::n_heaps;
+    int start = ((start_heap < 0) ? 0 : start_heap) % n;
+    for (int i = 0; i < n; i++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [(start + i) % n];
+        Object* O = hp->finalize_queue->GetNextFinalizableObject(TRUE);
+        if (O)
+            return O;
+    }
+    return 0;
+#else //MULTIPLE_HEAPS
+    UNREFERENCED_PARAMETER(start_heap);
+    return pGenGCHeap->finalize_queue->GetNextFinalizableObject(TRUE);
+#endif //MULTIPLE_HEAPS
+}
+
 size_t GCHeap::GetNumberFinalizableObjects()
 {
 #ifdef MULTIPLE_HEAPS
@@ -205,6 +205,7 @@ public:
     FinalizerWorkItem* GetExtraWorkForFinalization();
     uint64_t GetGenerationBudget(int generation);
     size_t GetLOHThreshold();
+    Object* GetNextNonCriticalFinalizable(int start_heap);
 
     unsigned GetGcCount();
 
@@ -11,7 +11,7 @@
 // The minor version of the IGCHeap interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interoperate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 2
+#define GC_INTERFACE_MINOR_VERSION 3
 
 // The major version of the IGCToCLR interface. Breaking changes to this interface
 // require bumps in the major version number.
@@ -182,6 +182,9 @@ struct gc_alloc_context
     void*          gc_reserved_1;
     void*          gc_reserved_2;
     int            alloc_count;
+    // Owned by the GC; tracks how often this context is refilled so the GC can size
+    // its allocation quantum. Fits in what used to be tail padding.
+    uint32_t       alloc_quantum_info;
 public:
 
     void init()
@@ -195,6 +198,7 @@ public:
         gc_reserved_1 = 0;
         gc_reserved_2 = 0;
         alloc_count = 0;
+        alloc_quantum_info = 0;
     }
 };
 
@@ -1025,6 +1029,12 @@ public:
     virtual uint64_t GetGenerationBudget(int generation) PURE_VIRTUAL
 
     virtual size_t GetLOHThreshold() PURE_VIRTUAL
+
+    // Gets the next object with a normal (non critical) finalizer, looking at the heaps'
+    // queues starting from start_heap (taken modulo the heap count). Returns nullptr once none
+    // are left. Lets several EE threads drain the queues in parallel; critical finalizers are
+    // only ever handed out by GetNextFinalizable.
+    virtual Object* GetNextNonCriticalFinalizable(int start_heap) PURE_VIRTUAL
 };
 
 #ifdef WRITE_BARRIER_CHECK
@@ -206,13 +206,6 @@ inline void FATAL_GC_ERROR()
 //#define SNOOP_STATS //diagnostic
 #endif //SERVER_GC
 
-//This is used to mark some type volatile only when the scalable marking is used.
-#if defined (SERVER_GC) && defined (MH_SC_MARK)
-#define SERVER_SC_MARK_VOLATILE(x) VOLATILE(x)
-#else //SERVER_GC&&MH_SC_MARK
-#define SERVER_SC_MARK_VOLATILE(x) x
-#endif //SERVER_GC&&MH_SC_MARK
-
 //#define MULTIPLE_HEAPS         //Allow multiple heaps for servers
 
 #define CARD_BUNDLE         //enable card bundle feature.(requires WRITE_WATCH)
@@ -406,6 +399,11 @@ class recursive_gc_sync;
 // so turn it on for server GC, turn on for workstation GC if necessary
 #define FEATURE_CARD_MARKING_STEALING
 //#endif //!USE_REGIONS
+
+// BGC threads that are done with their own heap's sweep help walk other heaps' UOH regions.
+#if defined(BACKGROUND_GC) && defined(USE_REGIONS)
+#define BGC_UOH_SWEEP_STEALING
+#endif //BACKGROUND_GC && USE_REGIONS
 #endif //MULTIPLE_HEAPS
 
 #ifdef FEATURE_CARD_MARKING_STEALING
@@ -757,6 +755,40 @@ struct etw_bucket_info
 };
 #endif //FEATURE_EVENT_TRACE
 
+#ifdef FEATURE_EVENT_TRACE
+// Live size of one type as seen by a full blocking mark, broken down by the generation
+// the objects were in. Kept in a small open addressed table per heap, keyed by MT.
+#define LIVE_TYPE_STATS_TABLE_SIZE (1024)
+#define LIVE_TYPE_STATS_MAX_PROBES (8)
+struct live_type_stat
+{
+    MethodTable* mt;
+    size_t count;
+    size_t size[total_generation_count];
+};
+#endif //FEATURE_EVENT_TRACE
+
+#ifdef BGC_UOH_SWEEP_STEALING
+// A UOH region the owning heap publishes at the start of its UOH sweep. Whichever BGC thread
+// claims it walks it and leaves the gaps between survivors as free objects chained through
+// free_list_slot; the owner then threads that chain onto its free list in region order.
+struct bgc_uoh_sweep_item
+{
+    heap_segment* seg;
+    uint8_t* plug_end;
+    uint8_t* gap_list;
+    size_t free_size;
+    VOLATILE(int32_t) state;
+};
+
+enum bgc_uoh_sweep_item_state
+{
+    bgc_uoh_sweep_unclaimed = 0,
+    bgc_uoh_sweep_claimed = 1,
+    bgc_uoh_sweep_done = 2
+};
+#endif //BGC_UOH_SWEEP_STEALING
+
 #ifdef DYNAMIC_HEAP_COUNT
 struct min_fl_list_info
 {
@@ -1453,6 +1485,42 @@ public:
     void verify_empty();
 };
 
+#ifdef MH_SC_MARK
+// A bounded Chase-Lev work stealing deque used to share marking work between
+// server GC threads. The owning heap pushes and pops at the bottom, other GC
+// threads that ran out of their own marking work steal from the top. Only
+// whole objects (never partial mark tuples) are put on this deque so a thief
+// can start marking through a stolen object right away. When the deque is full
+// the owner simply keeps the object on its own mark stack.
+class mark_steal_deque
+{
+    static const uint32_t slot_count = 4096;
+    static_assert((slot_count & (slot_count - 1)) == 0, "slot_count must be a power of 2");
+
+    // top is modified by thieves, bottom only by the owner so keep them
+    // on different cache lines.
+    VOLATILE(uint32_t) top;
+    uint8_t pad[HS_CACHE_LINE_SIZE - sizeof(uint32_t)];
+    VOLATILE(uint32_t) bottom;
+    uint8_t* slot_table[slot_count];
+
+public:
+    mark_steal_deque();
+
+    bool push (uint8_t* o);
+    uint8_t* pop();
+    uint8_t* steal();
+
+    uint32_t count()
+    {
+        int32_t n = (int32_t)(bottom - top);
+        return ((n > 0) ? (uint32_t)n : 0);
+    }
+
+    void verify_empty();
+};
+#endif //MH_SC_MARK
+
 float median_of_3 (float a, float b, float c);
 
 //class definition of the internal class
@@ -1663,6 +1731,7 @@ private:
                                     heap_segment* region_to_delete,
                                     heap_segment* prev_region,
                                     heap_segment* next_region);
+    PER_HEAP_METHOD void init_gen2_compact_region_budget();
     PER_HEAP_METHOD bool should_sweep_in_plan (heap_segment* region);
 
     PER_HEAP_METHOD void sweep_region_in_plan (heap_segment* region,
@@ -1754,6 +1823,10 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void do_post_gc();
 
+    PER_HEAP_ISOLATED_METHOD void update_pause_target_budget_factor (uint64_t pause_duration);
+
+    PER_HEAP_ISOLATED_METHOD void update_memory_pressure();
+
     PER_HEAP_ISOLATED_METHOD void update_recorded_gen_data (last_recorded_gc_info* gc_info);
 
     PER_HEAP_METHOD void update_end_gc_time_per_heap();
@@ -2201,8 +2274,9 @@ private:
                           size_t& current_promoted_bytes,
                           size_t& last_promoted_bytes);
 
-    PER_HEAP_METHOD size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+    PER_HEAP_METHOD size_t limit_from_size (size_t size, alloc_context* acontext, uint32_t flags, size_t room,
+                            int gen_number, int align_const);
+    PER_HEAP_METHOD size_t get_alloc_quantum (alloc_context* acontext);
     PER_HEAP_METHOD allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
                                               int alloc_generation_number);
     PER_HEAP_ISOLATED_METHOD BOOL allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
@@ -2262,6 +2336,11 @@ private:
                                GCSpinLock* spin_lock, bool loh_p,
                                msl_take_state take_state);
 
+    PER_HEAP_METHOD uint8_t* find_best_fit_poh (allocator* poh_allocator,
+                                  unsigned int a_l_idx,
+                                  size_t size,
+                                  int align_const);
+
     PER_HEAP_METHOD BOOL a_fit_free_list_uoh_p (size_t size,
                                   alloc_context* acontext,
                                   uint32_t flags,
@@ -2600,6 +2679,11 @@ private:
     PER_HEAP_METHOD void add_to_promoted_bytes (uint8_t* object, int thread);
 
     PER_HEAP_METHOD void add_to_promoted_bytes (uint8_t* object, size_t obj_size, int thread);
+#ifdef FEATURE_EVENT_TRACE
+    PER_HEAP_METHOD void init_live_type_stats (int condemned_gen_number);
+    PER_HEAP_METHOD void record_live_type (uint8_t* object, size_t obj_size);
+    PER_HEAP_METHOD void fire_live_type_stats_events();
+#endif //FEATURE_EVENT_TRACE
 
     PER_HEAP_METHOD uint8_t* find_object (uint8_t* o);
 
@@ -2628,10 +2712,6 @@ private:
     PER_HEAP_METHOD mark* before_oldest_pin();
     PER_HEAP_METHOD BOOL pinned_plug_que_empty_p ();
     PER_HEAP_METHOD void make_mark_stack (mark* arr);
-#ifdef MH_SC_MARK
-    PER_HEAP_METHOD int& mark_stack_busy();
-    PER_HEAP_METHOD VOLATILE(uint8_t*)& ref_mark_stack (gc_heap* hp, int index);
-#endif
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED_METHOD size_t&  bpromoted_bytes (int);
     PER_HEAP_METHOD void make_background_mark_stack (uint8_t** arr);
@@ -2650,6 +2730,7 @@ private:
     PER_HEAP_METHOD void drain_mark_queue();
 
 #ifdef MH_SC_MARK
+    PER_HEAP_METHOD gc_heap* find_mark_steal_victim();
     PER_HEAP_METHOD void mark_steal ();
 #endif //MH_SC_MARK
 
@@ -2691,6 +2772,14 @@ private:
 
     PER_HEAP_METHOD void background_ephemeral_sweep();
     PER_HEAP_METHOD void background_sweep ();
+#ifdef BGC_UOH_SWEEP_STEALING
+    PER_HEAP_METHOD void publish_bgc_uoh_sweep_items();
+    PER_HEAP_METHOD void retire_bgc_uoh_sweep_items();
+    PER_HEAP_METHOD void bgc_sweep_uoh_item (bgc_uoh_sweep_item* item);
+    PER_HEAP_METHOD BOOL bgc_take_swept_uoh_region (heap_segment* seg, generation* gen,
+                                                   uint8_t** plug_end, size_t* free_size);
+    PER_HEAP_METHOD void help_bgc_uoh_sweep();
+#endif //BGC_UOH_SWEEP_STEALING
     // Check if we should grow the mark stack proactively to avoid mark stack
     // overflow and grow if necessary.
     PER_HEAP_METHOD void check_bgc_mark_stack_length();
@@ -2730,10 +2819,6 @@ private:
     PER_HEAP_METHOD void print_snoop_stat();
 #endif //SNOOP_STATS
 
-#ifdef MH_SC_MARK
-    PER_HEAP_METHOD BOOL check_next_mark_stack (gc_heap* next_heap);
-#endif //MH_SC_MARK
-
     PER_HEAP_METHOD void scan_dependent_handles (int condemned_gen_number, ScanContext *sc, BOOL initial_scan_p);
 
     PER_HEAP_METHOD size_t get_generation_start_size (int gen_number);
@@ -3141,6 +3226,9 @@ private:
 
     PER_HEAP_METHOD BOOL ephemeral_gen_fit_p (gc_tuning_point tp);
     PER_HEAP_METHOD void sweep_uoh_objects (int gen_num);
+    PER_HEAP_METHOD void reset_poh_frag_stats();
+    PER_HEAP_METHOD void record_poh_region_frag (heap_segment* seg, size_t free_size);
+    PER_HEAP_METHOD void fire_poh_frag_event();
     PER_HEAP_METHOD void relocate_in_uoh_objects (int gen_num);
     PER_HEAP_METHOD void mark_through_cards_for_uoh_objects(card_fn fn, int oldest_gen_num, BOOL relocating
                                               CARD_MARKING_STEALING_ARG(gc_heap* hpt));
@@ -3394,6 +3482,10 @@ private:
 
     PER_HEAP_FIELD_SINGLE_GC mark_queue_t mark_queue;
 
+#ifdef MH_SC_MARK
+    PER_HEAP_FIELD_SINGLE_GC mark_steal_deque mark_steal_queue;
+#endif //MH_SC_MARK
+
     PER_HEAP_FIELD_SINGLE_GC int gc_policy;  //sweep, compact, expand
 
     PER_HEAP_FIELD_SINGLE_GC size_t total_promoted_bytes;
@@ -3468,6 +3560,15 @@ private:
     PER_HEAP_FIELD_SINGLE_GC heap_segment* current_sweep_seg;
 #endif //DOUBLY_LINKED_FL
 
+#ifdef BGC_UOH_SWEEP_STEALING
+    // Published by this heap's BGC thread while it sweeps UOH. Other BGC threads only look at
+    // bgc_uoh_sweep_items while they are counted in bgc_uoh_sweep_helpers.
+    PER_HEAP_FIELD_SINGLE_GC bgc_uoh_sweep_item* bgc_uoh_sweep_items;
+    PER_HEAP_FIELD_SINGLE_GC VOLATILE(int32_t) bgc_uoh_sweep_item_count;
+    PER_HEAP_FIELD_SINGLE_GC VOLATILE(int32_t) bgc_uoh_sweep_helpers;
+    PER_HEAP_FIELD_SINGLE_GC int bgc_uoh_sweep_item_index;
+#endif //BGC_UOH_SWEEP_STEALING
+
 #ifdef USE_REGIONS
     PER_HEAP_FIELD_SINGLE_GC BOOL      background_overflow_p;
 #else
@@ -3501,6 +3602,12 @@ private:
     PER_HEAP_FIELD_SINGLE_GC int sip_maxgen_regions_per_gen[max_generation + 1];
     PER_HEAP_FIELD_SINGLE_GC heap_segment* reserved_free_regions_sip[max_generation];
 
+    // When GCGen2CompactRegionBudget is set, a gen2 GC only evacuates up to that many of the sparsest
+    // gen2 regions; the rest are swept in plan. These record which regions qualify for this GC.
+    PER_HEAP_FIELD_SINGLE_GC bool gen2_compact_budget_p;
+    PER_HEAP_FIELD_SINGLE_GC int gen2_compact_regions_left;
+    PER_HEAP_FIELD_SINGLE_GC int gen2_compact_surv_ratio_th;
+
     // Used to keep track of the total regions in each condemned generation. For SIP regions we need
     // to know if we've made all regions in a condemned gen into a max_generation region; if so we
     // would want to revert our decision so we leave at least one region in that generation. Otherwise
@@ -3549,6 +3656,19 @@ private:
     // should also enable this for LOH compaction.
     PER_HEAP_FIELD_SINGLE_GC size_t* survived_per_region;
     PER_HEAP_FIELD_SINGLE_GC size_t* old_card_survived_per_region;
+#endif //USE_REGIONS
+
+#ifdef FEATURE_EVENT_TRACE
+    // Allocated on the first full blocking GC with live type stats on. Only filled in while
+    // live_type_stats_active_p is set; entries are added by this heap's mark thread, whichever
+    // heap the object lives on.
+    PER_HEAP_FIELD_SINGLE_GC live_type_stat* live_type_stats;
+    PER_HEAP_FIELD_SINGLE_GC bool live_type_stats_active_p;
+    // Bytes we couldn't attribute to a type because the table ran out of room.
+    PER_HEAP_FIELD_SINGLE_GC size_t live_type_stats_dropped_size;
+#endif //FEATURE_EVENT_TRACE
+
+#ifdef USE_REGIONS
 
     PER_HEAP_FIELD_SINGLE_GC bool special_sweep_p;
 
@@ -3644,6 +3764,11 @@ private:
     // calculated at the end of a GC and used in allocator
     PER_HEAP_FIELD_SINGLE_GC_ALLOC size_t allocation_quantum;
 
+    // How many alloc contexts had their quantum grown/shrunk since the last GC; only
+    // changed under more_space_lock_soh and logged when the next quantum is decided.
+    PER_HEAP_FIELD_SINGLE_GC_ALLOC size_t alloc_quantum_grown_count;
+    PER_HEAP_FIELD_SINGLE_GC_ALLOC size_t alloc_quantum_shrunk_count;
+
     // TODO: actually a couple of entries in these elements are carried over from GC to GC -
     // collect_count and previous_time_clock. It'd be nice to isolate these out.
     // Only field used by allocation is new_allocation.
@@ -3707,6 +3832,16 @@ private:
     // freed later during that GC.
     PER_HEAP_FIELD_MAINTAINED heap_segment* freeable_uoh_segment;
 
+    // POH is never compacted so the free space the last sweep left between pinned objects
+    // is all we can reuse. These are recomputed on every sweep of POH (blocking or BGC).
+    // poh_frag_regions buckets the regions by the % of their used range that is free -
+    // [0, 25%), [25%, 50%), [50%, 75%), [75%, 100%].
+#define POH_FRAG_BUCKETS (4)
+    PER_HEAP_FIELD_MAINTAINED size_t poh_frag_regions[POH_FRAG_BUCKETS];
+    PER_HEAP_FIELD_MAINTAINED size_t poh_frag_free_bytes;
+    PER_HEAP_FIELD_MAINTAINED size_t poh_frag_used_bytes;
+    PER_HEAP_FIELD_MAINTAINED size_t poh_frag_max_region_free;
+
     // These *alloc_list fields are init-ed once and used throughput process lifetime, they contained fields
     // that are maintained via these generations' free_list_allocator. LOH/POH's alloc_lists are also used
     // by the allocator so they are in the PER_HEAP_FIELD_MAINTAINED_ALLOC section.
@@ -4071,7 +4206,9 @@ private:
     // Also updated on the heap#0 GC thread because that's where we are actually doing the decommit.
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC BOOL gradual_decommit_in_progress_p;
 #ifdef MH_SC_MARK
-    PER_HEAP_ISOLATED_FIELD_SINGLE_GC int* g_mark_stack_busy;
+    // Number of GC threads that ran out of marking work and are trying to steal
+    // from other heaps' mark_steal_queue. Reset to 0 at the beginning of each mark phase.
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(int32_t) mark_steal_idle_count;
 #endif //MH_SC_MARK
 
 #if !defined(USE_REGIONS) || defined(_DEBUG)
@@ -4089,6 +4226,12 @@ private:
 #endif //BACKGROUND_GC
 #endif //MULTIPLE_HEAPS
 
+#ifdef BGC_UOH_SWEEP_STEALING
+    // Number of heaps that haven't finished their UOH sweep in this BGC; helpers stop looking
+    // for regions to sweep once it gets to 0.
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(int32_t) bgc_uoh_sweep_heaps_remaining;
+#endif //BGC_UOH_SWEEP_STEALING
+
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(c_gc_state) current_c_gc_state;
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC gc_mechanisms saved_bgc_settings;
@@ -4209,6 +4352,18 @@ private:
 
     PER_HEAP_ISOLATED_FIELD_MAINTAINED uint64_t gc_last_ephemeral_decommit_time;
 
+    // Only used when pause_target_us is set. The gen0/gen1 budgets are scaled by this factor
+    // which goes down when an ephemeral GC pauses longer than the target and goes back up
+    // when the smoothed pause leaves enough headroom.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED float pause_target_budget_factor;
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED uint64_t pause_target_smoothed_pause;
+
+    // Last OS reported memory pressure (PSI some avg10) and whether we are reacting to it -
+    // set once it reaches memory_pressure_th and only cleared once it drops below half of that.
+    // While set we halve the gen0 budget and don't pace decommitting free regions.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED uint32_t memory_pressure;
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED bool memory_pressure_p;
+
     // maintained as we need to grow bookkeeping data.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t card_table_element_layout[total_bookkeeping_elements + 1];
 
@@ -5102,6 +5257,12 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int generation_skip_ratio_threshold;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int conserve_mem_setting;
 
+    // From GCPauseTargetMs, in us. 0 means we are not trying to meet a pause target.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint64_t pause_target_us;
+
+    // From GCMemoryPressureThreshold. 0 means we ignore OS memory pressure signals.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint32_t memory_pressure_th;
+
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool spin_count_unit_config_p;
 
     // For SOH we always allocate segments of the same size (except for segments when no_gc_region requires larger ones).
@@ -5179,6 +5340,18 @@ private:
     // Indicate to use large pages. This only works if hardlimit is also enabled.
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool use_large_pages_p;
 
+    // Indicate to ask the OS for transparent huge pages for the heap and its bookkeeping.
+    // Unlike use_large_pages_p this doesn't need a hard limit since nothing is committed upfront.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool use_transparent_huge_pages_p;
+
+    // Scale each alloc context's quantum by how often it gets refilled - see get_alloc_quantum.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool adaptive_alloc_quantum_p;
+
+#ifdef FEATURE_EVENT_TRACE
+    // Collect per type live sizes during full blocking GCs - see record_live_type.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool live_type_stats_p;
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef MULTIPLE_HEAPS
     // Init-ed in gc_heap::initialize_gc
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY gc_heap** g_heaps;
@@ -5206,6 +5379,7 @@ private:
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t regions_range;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool enable_special_regions_p;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY int gen2_compact_region_budget;
 #else //USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t eph_gen_starts_size;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_segment_size;
@@ -6035,6 +6209,10 @@ public:
     //
     // swept_in_plan_p can be folded into gen_num.
     bool            swept_in_plan_p;
+    // The NUMA node of the heap this region was committed for. The memory stays on
+    // that node until the region is decommitted; a region handed to a heap with
+    // nothing committed takes that heap's node (see get_free_region).
+    uint16_t        numa_node;
     int             plan_gen_num;
     int             old_card_survived;
     int             pinned_survived;
@@ -6471,6 +6649,11 @@ int& heap_segment_plan_gen_num (heap_segment* inst)
     return inst->plan_gen_num;
 }
 inline
+uint16_t& heap_segment_numa_node (heap_segment* inst)
+{
+    return inst->numa_node;
+}
+inline
 int& heap_segment_age_in_free (heap_segment* inst)
 {
     return inst->age_in_free;
@@ -20,7 +20,7 @@
 
 #define SERVER_GC 1
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64) || (defined(TARGET_ARM64) && !defined(FEATURE_NATIVEAOT))
 #include "vxsort/do_vxsort.h"
 #endif
 
@@ -612,6 +612,10 @@ void HndWriteBarrierWorker(OBJECTHANDLE handle, _UNCHECKED_OBJECTREF value)
             // we just set the clump age to 0, which means that whoever wins the race
             // results are the same, as GC will always look at the clump
             *pClumpAge = (uint8_t)0;
+
+            // the segment's minimum age must not be older than any of its clumps; the same race
+            // applies so we also just set it to 0
+            ((volatile TableSegment *)barrier)->bMinAge = (uint8_t)0;
         }
     }
 }
@@ -658,6 +662,7 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
     info.uFlags          = (fAsync? HNDGCF_ASYNC : HNDGCF_NORMAL);
     info.fEnumUserData   = fEnumUserData;
     info.dwAgeMask       = 0;
+    info.uSkipAge        = 0xFF;
     info.pCurrentSegment = NULL;
     info.pfnScan         = pfnEnum;
     info.param1          = lParam1;
@@ -767,6 +772,7 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
     info.uFlags          = flags;
     info.fEnumUserData   = enumUserData;
     info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.uSkipAge        = ((condemned < maxgen) ? condemned : 0xFF);
     info.pCurrentSegment = NULL;
     info.pfnScan         = scanProc;
     info.param1          = param1;
@@ -829,6 +835,7 @@ void HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCou
     info.uFlags          = flags;
     info.fEnumUserData   = FALSE;
     info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.uSkipAge        = ((condemned < maxgen) ? condemned : 0xFF);
     info.pCurrentSegment = NULL;
     info.pfnScan         = NULL;
     info.param1          = 0;
@@ -869,6 +876,7 @@ void HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCou
     info.uFlags          = flags;
     info.fEnumUserData   = FALSE;
     info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.uSkipAge        = 0xFF;
     info.pCurrentSegment = NULL;
     info.pfnScan         = NULL;
     info.param1          = 0;
@@ -521,6 +521,7 @@ BOOL SegmentInitialize(TableSegment *pSegment, HandleTable *pTable)
 
     // now preinitialize the 0xFF guys
     memset(pSegment->rgGeneration, 0xFF,            sizeof(pSegment->rgGeneration));
+    pSegment->bMinAge = 0xFF;
     memset(pSegment->rgTail,       BLOCK_INVALID,   sizeof(pSegment->rgTail));
     memset(pSegment->rgHint,       BLOCK_INVALID,   sizeof(pSegment->rgHint));
     memset(pSegment->rgFreeMask,   0xFF,            sizeof(pSegment->rgFreeMask));
@@ -166,6 +166,15 @@ struct _TableSegmentHeader
      * Indicates the segment sequence number.
      */
     uint8_t bSequence;
+
+    /*
+     * Minimum Age
+     *
+     * A lower bound of the clump ages in rgGeneration. Anything that makes a clump younger
+     * makes this at least as young, and it's recomputed when the segment is aged, so an
+     * ephemeral GC can skip segments that only have handles to older generations.
+     */
+    uint8_t bMinAge;
 };
 
 typedef DPTR(struct _TableSegmentHeader) PTR__TableSegmentHeader;
@@ -263,6 +272,7 @@ struct ScanCallbackInfo
     uintptr_t        param1;            // callback param 1
     uintptr_t        param2;            // callback param 2
     uint32_t         dwAgeMask;         // generation mask for ephemeral GCs
+    uint32_t         uSkipAge;          // segments with a bMinAge above this have no clumps to scan
 
 #ifdef _DEBUG
     uint32_t DEBUG_BlocksScanned;
@@ -924,6 +934,15 @@ void CALLBACK BlockAgeBlocksEphemeral(PTR_TableSegment pSegment, uint32_t uBlock
 void CALLBACK BlockResetAgeMapForBlocks(PTR_TableSegment pSegment, uint32_t uBlock, uint32_t uCount, ScanCallbackInfo *pInfo);
 
 
+/*
+ * SegmentUpdateMinAge
+ *
+ * Recomputes the minimum clump age of a segment.
+ *
+ */
+void SegmentUpdateMinAge(PTR_TableSegment pSegment);
+
+
 /*
  * BlockVerifyAgeMapForBlocks
  *
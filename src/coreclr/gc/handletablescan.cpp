@@ -831,6 +831,8 @@ void BlockResetAgeMapForBlocksWorker(uint32_t *pdwGen, uint32_t dwClumpMask, Sca
             }
             _ASSERTE(FitsInU1(minAge));
             ((uint8_t *)pSegment->rgGeneration)[uClump] = static_cast<uint8_t>(minAge);
+            if (pSegment->bMinAge > minAge)
+                pSegment->bMinAge = static_cast<uint8_t>(minAge);
         }
         // skip to the next clump
         dwClumpMask = NEXT_CLUMP_IN_MASK(dwClumpMask);
@@ -1694,6 +1696,39 @@ void SegmentScanByTypeMap(PTR_TableSegment pSegment, const BOOL *rgTypeInclusion
 }
 
 
+#ifndef DACCESS_COMPILE
+/*
+ * SegmentUpdateMinAge
+ *
+ * Recomputes the minimum clump age of a segment.
+ *
+ */
+void SegmentUpdateMinAge(PTR_TableSegment pSegment)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // only committed blocks can have handles; the rest are still 0xFF
+    uint8_t *pbGen     = pSegment->rgGeneration;
+    uint8_t *pbGenLast = pbGen + (pSegment->bCommitLine * sizeof(uint32_t));
+
+    uint8_t bMinAge = 0xFF;
+    for ( ; pbGen < pbGenLast; pbGen++)
+    {
+        if (*pbGen < bMinAge)
+        {
+            bMinAge = *pbGen;
+
+            // can't get any younger than this
+            if (bMinAge == 0)
+                break;
+        }
+    }
+
+    pSegment->bMinAge = bMinAge;
+}
+#endif // !DACCESS_COMPILE
+
+
 /*
  * TableScanHandles
  *
@@ -1724,13 +1759,20 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
     if (uTypeCount > 1)
         BuildInclusionMap(rgTypeInclusion, puType, uTypeCount);
 
+#ifndef DACCESS_COMPILE
+    // aging makes clumps older so that's when the segment's minimum age can go up; we can
+    // only do this while the write barrier can't be lowering ages at the same time
+    BOOL fUpdateMinAge = ((pInfo->uFlags & (HNDGCF_AGE | HNDGCF_ASYNC)) == HNDGCF_AGE);
+#endif
+
     // now, iterate over the segments, scanning blocks of the specified type(s)
     PTR_TableSegment pSegment = NULL;
     while ((pSegment = pfnSegmentIterator(pTable, pSegment, pCrstHolder)) != NULL)
     {
         // if there are types to scan then enumerate the blocks in this segment
         // (we do this test inside the loop since the iterators should still run...)
-        if (uTypeCount >= 1)
+        // an ephemeral scan only looks at young clumps so it can skip segments with none
+        if ((uTypeCount >= 1) && (pSegment->bMinAge <= pInfo->uSkipAge))
         {
             // make sure the "current segment" pointer in the scan info is up to date
             pInfo->pCurrentSegment = pSegment;
@@ -1749,6 +1791,11 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
 
             // make sure the "current segment" pointer in the scan info is up to date
             pInfo->pCurrentSegment = NULL;
+
+#ifndef DACCESS_COMPILE
+            if (fUpdateMinAge)
+                SegmentUpdateMinAge(pSegment);
+#endif
         }
     }
 }
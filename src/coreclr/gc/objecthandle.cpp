@@ -880,6 +880,109 @@ int getThreadCount(ScanContext* sc)
     return sc->thread_count;
 }
 
+// The handle scans that take most of the handle table time in a blocking GC and that every GC thread
+// does. Each one needs its own claim counters since a thread may start the next scan before the others
+// finish the current one.
+enum HandleScanPhase
+{
+    HandleScanPhase_Pinning,
+    HandleScanPhase_Strong,
+    HandleScanPhase_WeakShort,
+    HandleScanPhase_WeakLong,
+    HandleScanPhase_UpdatePointers,
+    HandleScanPhase_Count
+};
+
+struct HandleTableScanClaim
+{
+    // Index of the next (bucket, slot) table to hand out, flattened over the handle table map
+    VOLATILE(int32_t) iNextTable;
+    // Number of threads done claiming tables for this scan
+    VOLATILE(int32_t) iThreadsDone;
+};
+
+static HandleTableScanClaim g_HandleTableScanClaims[HandleScanPhase_Count];
+
+/*
+ * ScanHandleTablesInParallel
+ *
+ * Calls scanTable for all the handle tables this GC thread should scan.
+ *
+ * Handles are allocated in the table of the allocating thread's home heap so the tables can be
+ * very unbalanced, and with fewer GC threads than slots a thread striding over the slots can end
+ * up with several big tables. For blocking server GCs the threads instead claim tables one at a
+ * time so the ones done with small tables pick up the rest. All GC threads must call this for
+ * a given phase since the last one done resets the claim for the next GC.
+ *
+ */
+template <typename SCANTABLEPROC>
+void ScanHandleTablesInParallel(ScanContext* sc, HandleScanPhase phase, SCANTABLEPROC scanTable)
+{
+    WRAPPER_NO_CONTRACT;
+
+    int uCPUlimit = getNumberOfSlots();
+    assert(uCPUlimit > 0);
+    int uThreadCount = getThreadCount(sc);
+
+    // Concurrent scans overlap with foreground GCs so they keep using the fixed assignment.
+    if (!IsServerHeap() || sc->concurrent || (uThreadCount <= 1))
+    {
+        HandleTableMap *walk = &g_HandleTableMap;
+        while (walk) {
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+                if (walk->pBuckets[i] != NULL)
+                {
+                    int uCPUindex = getSlotNumber(sc);
+                    HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                    for ( ; uCPUindex < uCPUlimit; uCPUindex += uThreadCount)
+                    {
+                        HHANDLETABLE hTable = pTable[uCPUindex];
+                        if (hTable)
+                            scanTable(hTable);
+                    }
+                }
+            walk = walk->pNext;
+        }
+        return;
+    }
+
+    HandleTableScanClaim* pClaim = &g_HandleTableScanClaims[phase];
+    const int32_t iTablesPerMap = INITIAL_HANDLE_TABLE_ARRAY_SIZE * uCPUlimit;
+
+    HandleTableMap *walk = &g_HandleTableMap;
+    int32_t iWalkFirstTable = 0;
+    while (true)
+    {
+        int32_t iTable = Interlocked::Increment(&pClaim->iNextTable) - 1;
+
+        // our claims only ever increase so we never need to walk back
+        while (walk && (iTable >= (iWalkFirstTable + iTablesPerMap)))
+        {
+            walk = walk->pNext;
+            iWalkFirstTable += iTablesPerMap;
+        }
+
+        if (!walk)
+            break;
+
+        int32_t iTableInMap = iTable - iWalkFirstTable;
+        HandleTableBucket* pBucket = walk->pBuckets[iTableInMap / uCPUlimit];
+        if (pBucket != NULL)
+        {
+            HHANDLETABLE hTable = pBucket->pTable[iTableInMap % uCPUlimit];
+            if (hTable)
+                scanTable(hTable);
+        }
+    }
+
+    // the last thread done claiming resets the counters; this phase won't run again until the next join
+    if (Interlocked::Increment(&pClaim->iThreadsDone) == uThreadCount)
+    {
+        pClaim->iNextTable = 0;
+        Interlocked::Exchange(&pClaim->iThreadsDone, 0);
+    }
+}
+
 void SetDependentHandleSecondary(OBJECTHANDLE handle, OBJECTREF objref)
 {
     CONTRACTL
@@ -1060,33 +1163,16 @@ void Ref_TracePinningRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
     };
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
-                {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                    {
-                        // Pinned handles and async pinned handles are scanned in separate passes, since async pinned
-                        // handles may require a callback into the EE in order to fully trace an async pinned
-                        // object's object graph.
-                        HndScanHandlesForGC(hTable, PinObject, uintptr_t(sc), uintptr_t(fn), &types[0], 1, condemned, maxgen, flags);
+    ScanHandleTablesInParallel(sc, HandleScanPhase_Pinning, [&](HHANDLETABLE hTable)
+    {
+        // Pinned handles and async pinned handles are scanned in separate passes, since async pinned
+        // handles may require a callback into the EE in order to fully trace an async pinned
+        // object's object graph.
+        HndScanHandlesForGC(hTable, PinObject, uintptr_t(sc), uintptr_t(fn), &types[0], 1, condemned, maxgen, flags);
 #ifdef FEATURE_ASYNC_PINNED_HANDLES
-                        HndScanHandlesForGC(hTable, AsyncPinObject, uintptr_t(sc), uintptr_t(fn), &types[1], 1, condemned, maxgen, flags);
+        HndScanHandlesForGC(hTable, AsyncPinObject, uintptr_t(sc), uintptr_t(fn), &types[1], 1, condemned, maxgen, flags);
 #endif
-                    }
-                }
-            }
-        walk = walk->pNext;
-    }
+    });
 
 #ifdef FEATURE_VARIABLE_HANDLES
     // pin objects pointed to by variable handles whose dynamic type is VHT_PINNED
@@ -1107,27 +1193,10 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
     uint32_t uTypeCount = (((condemned >= maxgen) && !g_theGCHeap->IsConcurrentGCInProgress()) ? 1 : ARRAY_SIZE(types));
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
-                {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                    {
-                        HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags);
-                    }
-                }
-            }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesInParallel(sc, HandleScanPhase_Strong, [&](HHANDLETABLE hTable)
+    {
+        HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags);
+    });
 
 #ifdef FEATURE_VARIABLE_HANDLES
     // promote objects pointed to by variable handles whose dynamic type is VHT_STRONG
@@ -1217,27 +1286,10 @@ void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
     // check objects pointed to by short weak handles
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-        {
-            if (walk->pBuckets[i] != NULL)
-            {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
-                {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
-                }
-            }
-        }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesInParallel(sc, HandleScanPhase_WeakLong, [&](HHANDLETABLE hTable)
+    {
+        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+    });
 
 #ifdef FEATURE_VARIABLE_HANDLES
     // check objects pointed to by variable handles whose dynamic type is VHT_WEAK_LONG
@@ -1536,28 +1588,10 @@ void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
     };
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk)
+    ScanHandleTablesInParallel(sc, HandleScanPhase_WeakShort, [&](HHANDLETABLE hTable)
     {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-        {
-            if (walk->pBuckets[i] != NULL)
-            {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
-                {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
-                }
-            }
-        }
-        walk = walk->pNext;
-    }
+        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+    });
 
 #ifdef FEATURE_VARIABLE_HANDLES
     // check objects pointed to by variable handles whose dynamic type is VHT_WEAK_SHORT
@@ -1608,25 +1642,10 @@ void Ref_UpdatePointers(uint32_t condemned, uint32_t maxgen, ScanContext* sc, Re
     // perform a multi-type scan that updates pointers
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
-                {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, UpdatePointer, uintptr_t(sc), uintptr_t(fn), types, ARRAY_SIZE(types), condemned, maxgen, flags);
-                }
-            }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesInParallel(sc, HandleScanPhase_UpdatePointers, [&](HHANDLETABLE hTable)
+    {
+        HndScanHandlesForGC(hTable, UpdatePointer, uintptr_t(sc), uintptr_t(fn), types, ARRAY_SIZE(types), condemned, maxgen, flags);
+    });
 
 #ifdef FEATURE_VARIABLE_HANDLES
     // update pointers in variable handles whose dynamic type is VHT_WEAK_SHORT, VHT_WEAK_LONG or VHT_STRONG
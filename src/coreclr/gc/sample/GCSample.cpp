@@ -30,6 +30,10 @@
 // * Scanning of stack roots:
 //      static void GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc);
 //
+//  Running the sample as "gcsample churn [allocations] [retained]" additionally allocates against a retained
+//  working set that is replaced entry by entry, like a cache evicting old entries, and reports GC counts and
+//  pause time percentiles. It is meant for getting a quick signal on GC changes without a managed workload.
+//
 //  The sample has trivial implementation for these methods. It is single threaded, and there are no stack roots to
 //  be reported. There are number of other callbacks that GC calls to optionally allow the execution engine to do its
 //  own bookkeeping.
@@ -112,6 +116,43 @@ void WriteBarrier(Object ** dst, Object * ref)
     ErectWriteBarrier(dst, ref);
 }
 
+static int __cdecl ComparePauseTicks(const void* a, const void* b)
+{
+    int64_t pa = *(const int64_t*)a;
+    int64_t pb = *(const int64_t*)b;
+    return (pa < pb) ? -1 : ((pa > pb) ? 1 : 0);
+}
+
+static double PauseTicksToMs(int64_t ticks)
+{
+    return (double)ticks * 1000.0 / (double)GCToOSInterface::QueryPerformanceFrequency();
+}
+
+static void PrintGCStats(IGCHeap* pGCHeap, int64_t elapsedTicks)
+{
+    printf("Elapsed: %.2f ms\n", PauseTicksToMs(elapsedTicks));
+    printf("GCs: gen0 %d, gen1 %d, gen2 %d\n", pGCHeap->CollectionCount(0), pGCHeap->CollectionCount(1), pGCHeap->CollectionCount(2));
+    printf("Bytes in use: %zu\n", pGCHeap->GetTotalBytesInUse());
+
+    uint32_t count = g_GCPauseCount;
+    if (count == 0)
+        return;
+
+    int64_t total = 0;
+    for (uint32_t i = 0; i < count; i++)
+        total += g_GCPauseTicks[i];
+
+    qsort(g_GCPauseTicks, count, sizeof(g_GCPauseTicks[0]), ComparePauseTicks);
+
+    printf("Pauses: %u, total %.3f ms (%.1f%% of elapsed)\n", count, PauseTicksToMs(total),
+        elapsedTicks > 0 ? (double)total * 100.0 / (double)elapsedTicks : 0.0);
+    printf("Pause ms: p50 %.3f, p90 %.3f, p99 %.3f, max %.3f\n",
+        PauseTicksToMs(g_GCPauseTicks[count / 2]),
+        PauseTicksToMs(g_GCPauseTicks[(count * 9) / 10]),
+        PauseTicksToMs(g_GCPauseTicks[(count * 99) / 100]),
+        PauseTicksToMs(g_GCPauseTicks[count - 1]));
+}
+
 extern "C" HRESULT LOCALGC_CALLCONV GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
 
 int __cdecl main(int argc, char* argv[])
@@ -236,6 +277,51 @@ int __cdecl main(int argc, char* argv[])
     // Verify that the weak handle got cleared by the GC
     assert(HndFetchHandle(ohWeak) == NULL);
 
+    if (argc > 1 && strcmp(argv[1], "churn") == 0)
+    {
+        int allocations = (argc > 2) ? atoi(argv[2]) : 10000000;
+        int retained = (argc > 3) ? atoi(argv[3]) : 100000;
+        if (allocations <= 0 || retained <= 0)
+            return -1;
+
+        OBJECTHANDLE * retainedHandles = new OBJECTHANDLE[retained];
+        for (int i = 0; i < retained; i++)
+        {
+            retainedHandles[i] = HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], HNDTYPE_DEFAULT, NULL);
+            if (retainedHandles[i] == NULL)
+                return -1;
+        }
+
+        g_GCPauseCount = 0;
+        int64_t startTicks = GCToOSInterface::QueryPerformanceCounter();
+
+        uint32_t seed = 1;
+        for (int i = 0; i < allocations; i++)
+        {
+            Object * p = AllocateObject(pMyMethodTable);
+            if (p == NULL)
+                return -1;
+
+            // Every 16th object replaces a random retained entry and keeps the entry it evicts alive
+            // until it is evicted in turn, so there is a steady stream of survivors to promote.
+            if ((i & 15) == 0)
+            {
+                seed = seed * 1103515245 + 12345;
+                OBJECTHANDLE h = retainedHandles[(seed >> 8) % (uint32_t)retained];
+                WriteBarrier(&(((My *)p)->m_pOther2), HndFetchHandle(h));
+                if (((My *)p)->m_pOther2 != NULL)
+                    WriteBarrier(&(((My *)((My *)p)->m_pOther2)->m_pOther2), NULL);
+                HndAssignHandle(h, p);
+            }
+        }
+
+        PrintGCStats(pGCHeap, GCToOSInterface::QueryPerformanceCounter() - startTicks);
+
+        for (int i = 0; i < retained; i++)
+            HndDestroyHandle(HndGetHandleTable(retainedHandles[i]), HNDTYPE_DEFAULT, retainedHandles[i]);
+        delete[] retainedHandles;
+    }
+
     printf("Done\n");
 
     return 0;
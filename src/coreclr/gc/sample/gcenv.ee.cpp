@@ -124,8 +124,14 @@ void ThreadStore::AttachCurrentThread()
     g_pThreadList = pThread;
 }
 
+int64_t g_GCPauseTicks[MaxRecordedGCPauses];
+uint32_t g_GCPauseCount = 0;
+static int64_t g_GCPauseStartTicks;
+
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
+    g_GCPauseStartTicks = GCToOSInterface::QueryPerformanceCounter();
+
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
@@ -136,6 +142,11 @@ void GCToEEInterface::RestartEE(bool bFinishedGC)
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
+
+    if (g_GCPauseCount < MaxRecordedGCPauses)
+    {
+        g_GCPauseTicks[g_GCPauseCount++] = GCToOSInterface::QueryPerformanceCounter() - g_GCPauseStartTicks;
+    }
 }
 
 void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc)
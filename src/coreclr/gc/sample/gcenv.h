@@ -137,6 +137,15 @@ public:
     static void AttachCurrentThread();
 };
 
+// -----------------------------------------------------------------------------------------------------------
+// GC pause tracking
+//
+
+// SuspendEE/RestartEE record the length of each pause so the sample can report pause statistics
+const uint32_t MaxRecordedGCPauses = 16384;
+extern int64_t g_GCPauseTicks[MaxRecordedGCPauses];
+extern uint32_t g_GCPauseCount;
+
 // -----------------------------------------------------------------------------------------------------------
 // Config file enumulation
 //
@@ -6,6 +6,12 @@
 #include "env/gcenv.os.h"
 #include "softwarewritewatch.h"
 
+#if defined(HOST_AMD64)
+#include <emmintrin.h>
+#elif defined(HOST_ARM64)
+#include <arm_neon.h>
+#endif
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 #ifndef DACCESS_COMPILE
 
@@ -28,6 +34,49 @@ void SoftwareWriteWatch::StaticClose()
     g_gc_sw_ww_table = nullptr;
 }
 
+// Returns the first block in [block, blockEnd) that has any page recorded as dirty, or blockEnd if there is none. Most of
+// the table is clean during a concurrent revisit, so this checks 64 bytes (64 pages) at a time where SIMD is available.
+static uint8_t *FindDirtyBlock(uint8_t *block, uint8_t *blockEnd)
+{
+    assert(ALIGN_DOWN(block, sizeof(size_t)) == block);
+    assert(ALIGN_DOWN(blockEnd, sizeof(size_t)) == blockEnd);
+
+#if defined(HOST_AMD64) || defined(HOST_ARM64)
+    const size_t bytesPerIteration = 64;
+    while (static_cast<size_t>(blockEnd - block) >= bytesPerIteration)
+    {
+#if defined(HOST_AMD64)
+        __m128i dirtyBytes =
+            _mm_or_si128(
+                _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i *>(block)),
+                             _mm_loadu_si128(reinterpret_cast<__m128i *>(block + 16))),
+                _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i *>(block + 32)),
+                             _mm_loadu_si128(reinterpret_cast<__m128i *>(block + 48))));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(dirtyBytes, _mm_setzero_si128())) != 0xffff)
+        {
+            break;
+        }
+#else
+        uint8x16_t dirtyBytes =
+            vorrq_u8(
+                vorrq_u8(vld1q_u8(block), vld1q_u8(block + 16)),
+                vorrq_u8(vld1q_u8(block + 32), vld1q_u8(block + 48)));
+        if (vmaxvq_u8(dirtyBytes) != 0)
+        {
+            break;
+        }
+#endif
+        block += bytesPerIteration;
+    }
+#endif // HOST_AMD64 || HOST_ARM64
+
+    while (block < blockEnd && *reinterpret_cast<size_t *>(block) == 0)
+    {
+        block += sizeof(size_t);
+    }
+    return block;
+}
+
 bool SoftwareWriteWatch::GetDirtyFromBlock(
     uint8_t *block,
     uint8_t *firstPageAddressInBlock,
@@ -188,6 +237,14 @@ void SoftwareWriteWatch::GetDirty(
 
         while (currentBlock < fullBlockEnd)
         {
+            uint8_t *dirtyBlock = FindDirtyBlock(currentBlock, fullBlockEnd);
+            firstPageAddressInCurrentBlock += (dirtyBlock - currentBlock) * WRITE_WATCH_UNIT_SIZE;
+            currentBlock = dirtyBlock;
+            if (currentBlock == fullBlockEnd)
+            {
+                break;
+            }
+
             if (!GetDirtyFromBlock(
                     currentBlock,
                     firstPageAddressInCurrentBlock,
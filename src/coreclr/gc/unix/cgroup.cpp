@@ -48,6 +48,9 @@ Abstract:
 #define CGROUP_MEMORY_STAT_FILENAME "/memory.stat"
 #define CGROUP1_MEMORY_USAGE_FILENAME "/memory.usage_in_bytes"
 #define CGROUP2_MEMORY_USAGE_FILENAME "/memory.current"
+#define CGROUP2_MEMORY_PRESSURE_FILENAME "/memory.pressure"
+#define PROC_PRESSURE_MEMORY_FILENAME "/proc/pressure/memory"
+#define PSI_SOME_AVG10_FIELD "some avg10="
 #define CGROUP1_MEMORY_USE_HIERARCHY_FILENAME "/memory.use_hierarchy"
 #define CGROUP1_MEMORY_STAT_HIERARCHICAL_MEMORY_LIMIT_FIELD "hierarchical_memory_limit "
 #define CGROUP1_MEMORY_STAT_INACTIVE_FIELD "total_inactive_file "
@@ -107,7 +110,58 @@ public:
         }
     }
 
+    // PSI is only available per cgroup on v2; otherwise fall back to the system wide file.
+    static bool GetMemoryPressure(uint32_t *val)
+    {
+        char* pressure_filename = nullptr;
+        if ((s_cgroup_version == 2) && (s_memory_cgroup_path != nullptr))
+        {
+            if (asprintf(&pressure_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_PRESSURE_FILENAME) < 0)
+                pressure_filename = nullptr;
+        }
+
+        bool result = ReadMemoryPressureFromFile(pressure_filename != nullptr ? pressure_filename : PROC_PRESSURE_MEMORY_FILENAME, val);
+        free(pressure_filename);
+        return result;
+    }
+
 private:
+    // Parses the 'some avg10=<percent>' field of a PSI file, rounding the percentage up.
+    static bool ReadMemoryPressureFromFile(const char* filename, uint32_t* val)
+    {
+        bool result = false;
+        char *line = nullptr;
+        size_t lineLen = 0;
+        size_t fieldLen = strlen(PSI_SOME_AVG10_FIELD);
+
+        FILE* file = fopen(filename, "r");
+        if (file == nullptr)
+            return false;
+
+        while (getline(&line, &lineLen, file) != -1)
+        {
+            if (strncmp(line, PSI_SOME_AVG10_FIELD, fieldLen) == 0)
+            {
+                errno = 0;
+                char* endptr = nullptr;
+                double avg10 = strtod(line + fieldLen, &endptr);
+                if ((errno == 0) && (endptr != line + fieldLen) && (avg10 >= 0))
+                {
+                    if (avg10 > 100.0)
+                        avg10 = 100.0;
+                    *val = (uint32_t)avg10;
+                    if ((double)*val < avg10)
+                        (*val)++;
+                    result = true;
+                }
+                break;
+            }
+        }
+
+        fclose(file);
+        free(line);
+        return result;
+    }
     static int FindCGroupVersion()
     {
         // It is possible to have both cgroup v1 and v2 enabled on a system.
@@ -614,6 +668,14 @@ size_t GetRestrictedPhysicalMemoryLimit()
     }
 }
 
+bool GetMemoryPressure(uint32_t* val)
+{
+    if (val == nullptr)
+        return false;
+
+    return CGroup::GetMemoryPressure(val);
+}
+
 bool GetPhysicalMemoryUsed(size_t* val)
 {
     bool result = false;
@@ -204,6 +204,7 @@ static pthread_mutex_t g_flushProcessWriteBuffersMutex;
 
 size_t GetRestrictedPhysicalMemoryLimit();
 bool GetPhysicalMemoryUsed(size_t* val);
+bool GetMemoryPressure(uint32_t* val);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
 
@@ -563,6 +564,73 @@ void GCToOSInterface::YieldThread(uint32_t switchCount)
     assert(ret == 0);
 }
 
+#ifdef MADV_HUGEPAGE
+// Alignment we use for ranges that asked for transparent huge pages so the kernel can
+// back them with PMD sized pages from the start of the range.
+#define TRANSPARENT_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+// The ranges reserved with VirtualReserveFlags::TransparentHugePages - the GC's region range
+// and its card/brick/mark array bookkeeping, which can briefly exist twice while the GC grows
+// it. The hint is applied once at reserve time; decommitting within one of these ranges keeps
+// the mapping so the hint stays in effect. A range reserved while all slots are in use
+// doesn't get the hint.
+#define MAX_TRANSPARENT_HUGE_PAGES_RANGES 4
+
+struct TransparentHugePagesRange
+{
+    uint8_t* start;
+    size_t size;
+};
+
+static TransparentHugePagesRange s_transparentHugePagesRanges[MAX_TRANSPARENT_HUGE_PAGES_RANGES];
+
+static bool AddTransparentHugePagesRange(void* address, size_t size)
+{
+    for (int i = 0; i < MAX_TRANSPARENT_HUGE_PAGES_RANGES; i++)
+    {
+        TransparentHugePagesRange* range = &s_transparentHugePagesRanges[i];
+        if (__sync_bool_compare_and_swap(&range->start, nullptr, (uint8_t*)address))
+        {
+            range->size = size;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void RemoveTransparentHugePagesRange(void* address)
+{
+    for (int i = 0; i < MAX_TRANSPARENT_HUGE_PAGES_RANGES; i++)
+    {
+        TransparentHugePagesRange* range = &s_transparentHugePagesRanges[i];
+        if (range->start == (uint8_t*)address)
+        {
+            range->size = 0;
+            __sync_synchronize();
+            range->start = nullptr;
+            return;
+        }
+    }
+}
+
+static bool IsInTransparentHugePagesRange(void* address, size_t size)
+{
+    for (int i = 0; i < MAX_TRANSPARENT_HUGE_PAGES_RANGES; i++)
+    {
+        const TransparentHugePagesRange* range = &s_transparentHugePagesRanges[i];
+        if ((range->start != nullptr) &&
+            ((uint8_t*)address >= range->start) &&
+            (((uint8_t*)address + size) <= (range->start + range->size)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif // MADV_HUGEPAGE
+
 // Reserve virtual memory range.
 // Parameters:
 //  size       - size of the virtual memory range
@@ -579,6 +647,14 @@ static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags,
         alignment = OS_PAGE_SIZE;
     }
 
+#ifdef MADV_HUGEPAGE
+    bool transparentHugePages = (flags & VirtualReserveFlags::TransparentHugePages) && (size >= TRANSPARENT_HUGE_PAGE_SIZE);
+    if (transparentHugePages && (alignment < TRANSPARENT_HUGE_PAGE_SIZE))
+    {
+        alignment = TRANSPARENT_HUGE_PAGE_SIZE;
+    }
+#endif // MADV_HUGEPAGE
+
     size_t alignedSize = size + (alignment - OS_PAGE_SIZE);
     void * pRetVal = mmap(nullptr, alignedSize, PROT_NONE, MAP_ANON | MAP_PRIVATE | hugePagesFlag, -1, 0);
 
@@ -607,6 +683,14 @@ static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags,
             madvise(pRetVal, size, MADV_DONTDUMP);
         }
 #endif
+#ifdef MADV_HUGEPAGE
+        if (transparentHugePages && AddTransparentHugePagesRange(pRetVal, size))
+        {
+            // This is only a hint - if THP is disabled or set to "never" this fails and
+            // we simply keep using normal pages.
+            madvise(pRetVal, size, MADV_HUGEPAGE);
+        }
+#endif // MADV_HUGEPAGE
         return pRetVal;
     }
 
@@ -634,6 +718,10 @@ void* GCToOSInterface::VirtualReserve(size_t size, size_t alignment, uint32_t fl
 //  true if it has succeeded, false if it has failed
 bool GCToOSInterface::VirtualRelease(void* address, size_t size)
 {
+#ifdef MADV_HUGEPAGE
+    RemoveTransparentHugePagesRange(address);
+#endif // MADV_HUGEPAGE
+
     int ret = munmap(address, size);
 
     return (ret == 0);
@@ -724,12 +812,25 @@ void* GCToOSInterface::VirtualReserveAndCommitLargePages(size_t size, uint16_t n
 //  true if it has succeeded, false if it has failed
 bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
 {
-    // TODO: This can fail, however the GC does not handle the failure gracefully
-    // Explicitly calling mmap instead of mprotect here makes it
-    // that much more clear to the operating system that we no
-    // longer need these pages. Also, GC depends on re-committed pages to
-    // be zeroed-out.
-    bool bRetVal = mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != MAP_FAILED;
+    bool bRetVal;
+#ifdef MADV_HUGEPAGE
+    if (IsInTransparentHugePagesRange(address, size))
+    {
+        // Replacing the mapping would drop the huge page hint of the reservation, so
+        // release the pages in place instead. MADV_DONTNEED also guarantees that the
+        // pages are zeroed-out when they are touched again.
+        bRetVal = (mprotect(address, size, PROT_NONE) == 0) && (madvise(address, size, MADV_DONTNEED) == 0);
+    }
+    else
+#endif // MADV_HUGEPAGE
+    {
+        // TODO: This can fail, however the GC does not handle the failure gracefully
+        // Explicitly calling mmap instead of mprotect here makes it
+        // that much more clear to the operating system that we no
+        // longer need these pages. Also, GC depends on re-committed pages to
+        // be zeroed-out.
+        bRetVal = mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != MAP_FAILED;
+    }
 
 #ifdef MADV_DONTDUMP
     if (bRetVal)
@@ -1423,6 +1524,38 @@ void GCToOSInterface::GetMemoryStatus(uint64_t restricted_limit, uint32_t* memor
         *available_page_file = GetAvailablePageFile();
 }
 
+// The kernel only recomputes the PSI averages every 2 seconds, so there is no point reading
+// the pressure file more often than this. It is queried at every GC and decommit step.
+#define MEMORY_PRESSURE_REFRESH_INTERVAL_MS 1000
+
+static uint64_t s_memoryPressureTimeStamp = 0;
+static uint32_t s_memoryPressure = 0;
+static bool s_memoryPressureAvailable = false;
+
+// Get memory pressure
+// Parameters:
+//  pressure - The percentage (0-100) of the last 10 seconds in which at least one task was stalled on memory.
+// Return:
+//  true if PSI is available, false otherwise.
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    uint64_t now = GetLowPrecisionTimeStamp();
+    if ((s_memoryPressureTimeStamp == 0) || ((now - s_memoryPressureTimeStamp) >= MEMORY_PRESSURE_REFRESH_INTERVAL_MS))
+    {
+        // Races between GC threads refreshing the cached value at the same time are benign.
+        uint32_t value = 0;
+        s_memoryPressureAvailable = ::GetMemoryPressure(&value);
+        s_memoryPressure = value;
+        VolatileStore(&s_memoryPressureTimeStamp, (now != 0) ? now : (uint64_t)1);
+    }
+
+    if (!s_memoryPressureAvailable)
+        return false;
+
+    *pressure = s_memoryPressure;
+    return true;
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
@@ -10,6 +10,22 @@
 
 #include "do_vxsort.h"
 
+#ifdef TARGET_ARM64
+
+enum class SupportedISA
+{
+    None = 0,
+    NEON = 1 << (int)InstructionSet::NEON
+};
+
+SupportedISA DetermineSupportedISA()
+{
+    // Advanced SIMD is mandatory on ARM64
+    return SupportedISA::NEON;
+}
+
+#else //TARGET_ARM64
+
 enum class SupportedISA
 {
     None = 0,
@@ -100,22 +116,30 @@ SupportedISA DetermineSupportedISA()
 
 #endif // defined(TARGET_UNIX)
 
+#endif //TARGET_ARM64
+
 static bool s_initialized;
 static SupportedISA s_supportedISA;
 
 bool IsSupportedInstructionSet (InstructionSet instructionSet)
 {
     assert(s_initialized);
+#ifdef TARGET_ARM64
+    assert(instructionSet == InstructionSet::NEON);
+#else
     assert(instructionSet == InstructionSet::AVX2 || instructionSet == InstructionSet::AVX512F);
+#endif
     return ((int)s_supportedISA & (1 << (int)instructionSet)) != 0;
 }
 
 void InitSupportedInstructionSet (int32_t configSetting)
 {
     s_supportedISA = (SupportedISA)((int)DetermineSupportedISA() & configSetting);
+#ifndef TARGET_ARM64
     // we are assuming that AVX2 can be used if AVX512F can,
     // so if AVX2 is disabled, we need to disable AVX512F as well
     if (!((int)s_supportedISA & (int)SupportedISA::AVX2))
         s_supportedISA = SupportedISA::None;
+#endif //!TARGET_ARM64
     s_initialized = true;
 }
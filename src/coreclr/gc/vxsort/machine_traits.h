@@ -15,6 +15,7 @@ enum vector_machine {
     AVX2,
     AVX512,
     SVE,
+    NEON,
 };
 
 template <typename T, vector_machine M>
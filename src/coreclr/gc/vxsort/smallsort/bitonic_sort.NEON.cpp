@@ -0,0 +1,110 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "bitonic_sort.NEON.h"
+
+using namespace vxsort;
+
+namespace {
+
+// NEON has no 64-bit integer min/max, so build them from a compare and a bit select.
+inline int32x4_t vec_min(int32x4_t a, int32x4_t b) { return vminq_s32(a, b); }
+inline int32x4_t vec_max(int32x4_t a, int32x4_t b) { return vmaxq_s32(a, b); }
+inline int64x2_t vec_min(int64x2_t a, int64x2_t b) { return vbslq_s64(vcgtq_s64(a, b), b, a); }
+inline int64x2_t vec_max(int64x2_t a, int64x2_t b) { return vbslq_s64(vcgtq_s64(a, b), a, b); }
+
+inline int32x4_t vec_load(const int32_t* p) { return vld1q_s32(p); }
+inline int64x2_t vec_load(const int64_t* p) { return vld1q_s64(p); }
+inline void vec_store(int32_t* p, int32x4_t v) { vst1q_s32(p, v); }
+inline void vec_store(int64_t* p, int64x2_t v) { vst1q_s64(p, v); }
+
+// Sorts buf in place, count must be a power of 2 and a multiple of N.
+template <typename T, int N>
+void bitonic_sort_padded(T* buf, size_t count)
+{
+    for (size_t k = 2; k <= count; k <<= 1)
+    {
+        for (size_t j = k >> 1; j > 0; j >>= 1)
+        {
+            if (j >= (size_t)N)
+            {
+                // i and its partner are both the first element of a vector, and all elements of
+                // a vector are sorted in the same direction since k > j >= N.
+                for (size_t i = 0; i < count; i += N)
+                {
+                    size_t l = i ^ j;
+                    if (l > i)
+                    {
+                        auto a = vec_load(buf + i);
+                        auto b = vec_load(buf + l);
+                        auto lo = vec_min(a, b);
+                        auto hi = vec_max(a, b);
+                        bool ascending = ((i & k) == 0);
+                        vec_store(buf + i, ascending ? lo : hi);
+                        vec_store(buf + l, ascending ? hi : lo);
+                    }
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    size_t l = i ^ j;
+                    if (l > i)
+                    {
+                        T a = buf[i];
+                        T b = buf[l];
+                        bool ascending = ((i & k) == 0);
+                        if ((a > b) == ascending)
+                        {
+                            buf[i] = b;
+                            buf[l] = a;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename T, int N>
+void bitonic_sort(T* ptr, size_t length)
+{
+    const size_t max_count = 16 * N;
+    assert(length <= max_count);
+
+    size_t count = N;
+    while (count < length)
+    {
+        count <<= 1;
+    }
+
+    // pad with the max value so the padding ends up at the end
+    alignas(16) T buf[max_count];
+    for (size_t i = 0; i < length; i++)
+    {
+        buf[i] = ptr[i];
+    }
+    for (size_t i = length; i < count; i++)
+    {
+        buf[i] = std::numeric_limits<T>::max();
+    }
+
+    bitonic_sort_padded<T, N>(buf, count);
+
+    for (size_t i = 0; i < length; i++)
+    {
+        ptr[i] = buf[i];
+    }
+}
+
+}
+
+void vxsort::smallsort::bitonic<int32_t, vector_machine::NEON>::sort(int32_t* ptr, size_t length) {
+    bitonic_sort<int32_t, N>(ptr, length);
+}
+
+void vxsort::smallsort::bitonic<int64_t, vector_machine::NEON>::sort(int64_t* ptr, size_t length) {
+    bitonic_sort<int64_t, N>(ptr, length);
+}
@@ -0,0 +1,32 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef BITONIC_SORT_NEON_H
+#define BITONIC_SORT_NEON_H
+
+#include <arm_neon.h>
+#include "bitonic_sort.h"
+
+namespace vxsort {
+namespace smallsort {
+
+// Unlike the AVX2/AVX512 versions these are not generated: with only 2 or 4
+// elements per NEON vector the networks are small enough to run a generic
+// bitonic network over a padded copy of the input, using vector min/max for
+// the stages that compare whole vectors and scalar compare-exchange for the
+// stages within a vector.
+template<> struct bitonic<int32_t, NEON> {
+    static const int N = 4;
+public:
+    static void sort(int32_t* ptr, size_t length);
+};
+
+template<> struct bitonic<int64_t, NEON> {
+    static const int N = 2;
+public:
+    static void sort(int64_t* ptr, size_t length);
+};
+
+}  // namespace smallsort
+}  // namespace vxsort
+#endif
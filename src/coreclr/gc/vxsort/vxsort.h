@@ -4,7 +4,7 @@
 #ifndef VXSORT_VXSORT_H
 #define VXSORT_VXSORT_H
 
-#ifdef __GNUC__
+#if defined(__GNUC__) && !defined(TARGET_ARM64)
 #ifdef __clang__
 #pragma clang attribute push (__attribute__((target("popcnt"))), apply_to = any(function))
 #else
@@ -14,7 +14,14 @@
 #endif
 
 #include <assert.h>
+#ifdef TARGET_ARM64
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include <arm_neon.h>
+#else
 #include <immintrin.h>
+#endif
 
 #include <minipal/utils.h>
 
@@ -30,6 +37,26 @@
 namespace vxsort {
 using vxsort::smallsort::bitonic;
 
+static INLINE int popcnt_u32(uint32_t v) {
+#ifndef TARGET_ARM64
+    return _mm_popcnt_u32(v);
+#elif defined(_MSC_VER)
+    return (int)_CountOneBits(v);
+#else
+    return __builtin_popcount(v);
+#endif
+}
+
+static INLINE int64_t popcnt_u64(uint64_t v) {
+#ifndef TARGET_ARM64
+    return _mm_popcnt_u64(v);
+#elif defined(_MSC_VER)
+    return (int64_t)_CountOneBits64(v);
+#else
+    return __builtin_popcountll(v);
+#endif
+}
+
 /**
  * sort primitives, quickly
  * @tparam T The primitive type being sorted
@@ -310,7 +337,7 @@ private:
         dataVec = MT::partition_vector(dataVec, mask);
         MT::store_vec(reinterpret_cast<TV*>(left), dataVec);
         MT::store_vec(reinterpret_cast<TV*>(right), dataVec);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -popcnt_u64(mask);
         right += popCount;
         left += popCount + N;
     }
@@ -320,7 +347,7 @@ private:
                                                      T*& left,
                                                      T*& right) {
         auto mask = MT::get_cmpgt_mask(dataVec, P);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -popcnt_u64(mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(left), dataVec, ~mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(right + N + popCount), dataVec, mask);
         right += popCount;
@@ -581,8 +608,8 @@ private:
         TV LT0 = MT::load_vec(preAlignedLeft);
         auto rtMask = MT::get_cmpgt_mask(RT0, P);
         auto ltMask = MT::get_cmpgt_mask(LT0, P);
-        const auto rtPopCountRightPart = max(_mm_popcnt_u32(rtMask), rightAlign);
-        const auto ltPopCountRightPart = _mm_popcnt_u32(ltMask);
+        const auto rtPopCountRightPart = max(popcnt_u32(rtMask), rightAlign);
+        const auto ltPopCountRightPart = popcnt_u32(ltMask);
         const auto rtPopCountLeftPart  = N - rtPopCountRightPart;
         const auto ltPopCountLeftPart  = N - ltPopCountRightPart;
 
@@ -656,6 +683,8 @@ private:
 
 }  // namespace gcsort
 
+#ifndef TARGET_ARM64
 #include "vxsort_targets_disable.h"
+#endif
 
 #endif
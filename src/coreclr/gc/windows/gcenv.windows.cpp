@@ -1064,6 +1064,17 @@ void GCToOSInterface::GetMemoryStatus(uint64_t restricted_limit, uint32_t* memor
     }
 }
 
+// Get memory pressure
+// Parameters:
+//  pressure - Unused.
+// Return:
+//  false, Windows has no stall based pressure signal; the GC relies on memory load there.
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    UNREFERENCED_PARAMETER(pressure);
+    return false;
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
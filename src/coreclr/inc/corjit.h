@@ -161,6 +161,32 @@ struct AllocMemArgs
     void* roDataBlockRW;
 };
 
+// Per-method compile time summary, reported by the JIT through ICorJitInfo::reportMetadata
+// under the "ThroughputSummary" key when DOTNET_JitThroughputSummary is enabled. Phases are
+// sorted by descending time; unused entries have a null name. The phase names are static
+// strings owned by the JIT.
+#define CORJIT_THROUGHPUT_SUMMARY_PHASES 5
+
+struct CorJitThroughputSummary
+{
+    uint32_t    ilCodeSize;
+    uint32_t    nativeCodeSize;
+    uint64_t    totalMicroseconds;
+    const char* phaseNames[CORJIT_THROUGHPUT_SUMMARY_PHASES];
+    uint64_t    phaseMicroseconds[CORJIT_THROUGHPUT_SUMMARY_PHASES];
+};
+
+// Reported by the JIT through ICorJitInfo::reportMetadata under the "OSRDeclined" key when a
+// Tier0 method with loops cannot escape to an OSR method, either for the whole method or for a
+// particular loop. The reason is a static string owned by the JIT.
+#define CORJIT_OSR_DECLINED_WHOLE_METHOD 0xFFFFFFFF
+
+struct CorJitOSRDeclined
+{
+    uint32_t    ilOffset; // IL offset of the loop, or CORJIT_OSR_DECLINED_WHOLE_METHOD
+    const char* reason;
+};
+
 #include "corjithost.h"
 
 extern "C" void jitStartup(ICorJitHost* host);
@@ -140,6 +140,11 @@ namespace ETW
         // GCSampledObjectAllocation*Keyword was used)
         static int s_nCustomMsBetweenEvents;
 
+        // Mean number of allocated bytes between two allocation samples (see
+        // code:ETW::TypeSystemLog::SampleObjectAllocationIfNecessary). 0 means allocation
+        // sampling is off.
+        static DWORD s_cbAllocationSamplingInterval;
+
     public:
         // This customizes the type logging behavior in LogTypeAndParametersIfNecessary
         enum TypeLogBehavior
@@ -165,6 +170,9 @@ namespace ETW
         static void PostRegistrationInit();
         static BOOL IsHeapAllocEventEnabled();
         static void SendObjectAllocatedEvent(Object * pObject);
+        static BOOL IsAllocationSamplingEnabled() { LIMITED_METHOD_CONTRACT; return s_cbAllocationSamplingInterval != 0; }
+        static void SampleObjectAllocationIfNecessary(Object * pObject);
+        static VOID SendAllocationSampleHistogram();
         static CrstBase * GetHashCrst();
         static VOID LogTypeAndParametersIfNecessary(BulkTypeEventLogger * pBulkTypeEventLogger, ULONGLONG thAsAddr, TypeLogBehavior typeLogBehavior);
         static VOID OnModuleUnload(Module * pModule);
@@ -43,11 +43,11 @@ typedef const GUID *LPCGUID;
 #define GUID_DEFINED
 #endif // !GUID_DEFINED
 
-constexpr GUID JITEEVersionIdentifier = { /* e428e66d-5e0e-4320-ad8a-fa5a50f6da07 */
-    0xe428e66d,
-    0x5e0e,
-    0x4320,
-    {0xad, 0x8a, 0xfa, 0x5a, 0x50, 0xf6, 0xda, 0x07}
+constexpr GUID JITEEVersionIdentifier = { /* 5e7a3c1d-4b92-4f0e-9c6a-81d3f2b7e045 */
+    0x5e7a3c1d,
+    0x4b92,
+    0x4f0e,
+    {0x9c, 0x6a, 0x81, 0xd3, 0xf2, 0xb7, 0xe0, 0x45}
   };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
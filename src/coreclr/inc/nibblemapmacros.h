@@ -51,4 +51,17 @@
 #define POS2SHIFTCOUNT(x)       (DWORD)  (HIGHEST_NIBBLE_BIT - (((x) & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE))
 #define POS2MASK(x)             (DWORD) ~(HIGHEST_NIBBLE_MASK >> (((x) & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE))
 
+// A map DWORD that lies entirely inside a code block holds no header nibbles. Instead of
+// leaving it empty, we store a "pointer" to the start of the block, so that lookups do not
+// have to scan backward over large blocks. A regular nibble never exceeds NIBBLES_PER_DWORD,
+// so a lowest nibble of NIBBLE_MAP_POINTER_TAG marks the DWORD as a pointer; the remaining
+// bits hold the start address relative to the map base in CODE_ALIGN units.
+#define BYTES_PER_MAP_DWORD     (BYTES_PER_BUCKET * NIBBLES_PER_DWORD)       // 256 bytes per DWORD
+#define NIBBLE_MAP_POINTER_TAG  NIBBLE_MASK
+#define MAX_NIBBLE_MAP_POINTER  ((size_t)1 << (HIGHEST_NIBBLE_BIT + LOG2_CODE_ALIGN)) // exclusive
+
+#define IS_NIBBLE_MAP_POINTER(dw)        (((dw) & NIBBLE_MASK) == NIBBLE_MAP_POINTER_TAG)
+#define ADDR2NIBBLE_MAP_POINTER(x)  (DWORD) ((((x) >> LOG2_CODE_ALIGN) << NIBBLE_SIZE) | NIBBLE_MAP_POINTER_TAG)
+#define NIBBLE_MAP_POINTER2ADDR(dw) (size_t) (((size_t)((dw) >> NIBBLE_SIZE)) << LOG2_CODE_ALIGN)
+
 #endif  // NIBBLEMAPMACROS_H_
@@ -2496,6 +2496,7 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     opts.compJitAlignLoopAdaptive       = JitConfig.JitAlignLoopAdaptive() == 1;
     opts.compJitAlignLoopBoundary       = (unsigned short)JitConfig.JitAlignLoopBoundary();
     opts.compJitAlignLoopMinBlockWeight = (unsigned short)JitConfig.JitAlignLoopMinBlockWeight();
+    opts.compJitAlignLoopMinTripCount   = (unsigned short)JitConfig.JitAlignLoopMinTripCount();
 
     opts.compJitAlignLoopForJcc             = JitConfig.JitAlignLoopForJcc() == 1;
     opts.compJitAlignLoopMaxCodeSize        = (unsigned short)JitConfig.JitAlignLoopMaxCodeSize();
@@ -2506,6 +2507,7 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     opts.compJitAlignLoopAdaptive           = true;
     opts.compJitAlignLoopBoundary           = DEFAULT_ALIGN_LOOP_BOUNDARY;
     opts.compJitAlignLoopMinBlockWeight     = DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT;
+    opts.compJitAlignLoopMinTripCount       = DEFAULT_ALIGN_LOOP_MIN_TRIP_COUNT;
     opts.compJitAlignLoopMaxCodeSize        = DEFAULT_MAX_LOOPSIZE_FOR_ALIGN;
     opts.compJitHideAlignBehindJmp          = true;
     opts.compJitOptimizeStructHiddenBuffer  = true;
@@ -3904,6 +3906,68 @@ void Compiler::compInitDebuggingInfo()
     }
 }
 
+//------------------------------------------------------------------------
+// compReportOSRDeclined: Tell the runtime that a Tier0 method, or one of its
+//   loops, cannot transition to optimized code via OSR.
+//
+// Arguments:
+//    ilOffset - IL offset of the loop, or BAD_IL_OFFSET for the whole method
+//    reason   - static string describing why
+//
+// Notes:
+//    The runtime surfaces this as the MethodJitOSRDeclined event, so that hot
+//    loops stuck in Tier0 code can be found in live processes.
+//
+void Compiler::compReportOSRDeclined(IL_OFFSET ilOffset, const char* reason)
+{
+    assert(reason != nullptr);
+
+    if (compIsForInlining())
+    {
+        return;
+    }
+
+    CorJitOSRDeclined declined;
+    declined.ilOffset = (ilOffset == BAD_IL_OFFSET) ? CORJIT_OSR_DECLINED_WHOLE_METHOD : ilOffset;
+    declined.reason   = reason;
+    info.compCompHnd->reportMetadata("OSRDeclined", &declined, sizeof(declined));
+}
+
+//------------------------------------------------------------------------
+// compCanEnregLocalsInTier0: See if this Tier0 method may keep some of
+//   its locals in registers.
+//
+// Returns:
+//    true if JitMinOptsEnregLocals is set and nothing in the method
+//    requires every local to live on the stack.
+//
+// Notes:
+//    Locals live on the stack in minopts so that LSRA can skip liveness
+//    and use its minimal allocator. Enregistering a few of the most
+//    referenced locals makes loop-heavy startup code, which may never
+//    reach the Tier1 call count threshold, considerably faster, at the
+//    cost of ref counting, liveness and the full LSRA allocator.
+//
+//    Methods with EH are excluded. In methods with patchpoints OSR method
+//    entry reads the IL locals from their Tier0 stack homes, so those stay on
+//    the stack (see lvaIsPatchpointLocal) while the JIT's temps may still be
+//    enregistered.
+//
+bool Compiler::compCanEnregLocalsInTier0()
+{
+    if ((JitConfig.JitMinOptsEnregLocals() <= 0) || compIsForInlining())
+    {
+        return false;
+    }
+
+    if (!opts.IsTier0() || opts.compDbgCode || (compHndBBtabCount > 0))
+    {
+        return false;
+    }
+
+    return true;
+}
+
 void Compiler::compSetOptimizationLevel()
 {
     bool theMinOptsValue;
@@ -4147,6 +4211,12 @@ _SetMinOpts:
         opts.compFlags &= ~CLFLG_MAXOPT;
         opts.compFlags |= CLFLG_MINOPT;
 
+        if (compCanEnregLocalsInTier0())
+        {
+            JITDUMP("Enregistering locals in Tier0 code\n");
+            opts.compFlags |= CLFLG_REGVAR;
+        }
+
         lvaEnregEHVars &= compEnregLocals();
         lvaEnregMultiRegVars &= compEnregLocals();
     }
@@ -4751,6 +4821,11 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
     if (compObjectStackAllocation() && opts.OptimizationEnabled())
     {
         objectAllocator.EnableObjectStackAllocation();
+
+        if (compObjectStackAllocationArray())
+        {
+            objectAllocator.EnableArrayStackAllocation();
+        }
     }
 
     objectAllocator.Run();
@@ -5451,6 +5526,9 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
 //   All innermost loops whose block weight meets a threshold are candidates for alignment.
 //   The top block of the loop is marked with the BBF_LOOP_ALIGN flag to indicate this.
 //
+//   With profile data, the loop must also run enough iterations per entry: the padding
+//   is executed on every entry, and a short-running loop gains little from alignment.
+//
 //   Depends on block weights being set.
 //
 bool Compiler::shouldAlignLoop(FlowGraphNaturalLoop* loop, BasicBlock* top)
@@ -5533,6 +5611,24 @@ bool Compiler::shouldAlignLoop(FlowGraphNaturalLoop* loop, BasicBlock* top)
         return false;
     }
 
+    if (fgHaveProfileWeights())
+    {
+        weight_t entryWeight = BB_ZERO_WEIGHT;
+        for (FlowEdge* const edge : loop->EntryEdges())
+        {
+            entryWeight += edge->getLikelyWeight();
+        }
+
+        const weight_t headerWeight = loop->GetHeader()->bbWeight;
+        const weight_t minTripCount = opts.compJitAlignLoopMinTripCount;
+        if ((entryWeight > BB_ZERO_WEIGHT) && (headerWeight < (entryWeight * minTripCount)))
+        {
+            JITDUMP("Skipping alignment for " FMT_LP "; averages " FMT_WT " iterations per entry < " FMT_WT ".\n",
+                    loop->GetIndex(), headerWeight / entryWeight, minTripCount);
+            return false;
+        }
+    }
+
     JITDUMP("Aligning " FMT_LP " that starts at " FMT_BB ", weight=" FMT_WT " >= " FMT_WT ".\n", loop->GetIndex(),
             top->bbNum, topWeight, compareWeight);
     return true;
@@ -6129,7 +6225,8 @@ int Compiler::compCompile(CORINFO_MODULE_HANDLE classPtr,
 
         checkedForJitTimeLog = true;
     }
-    if ((Compiler::compJitTimeLogFilename != nullptr) || (JitTimeLogCsv() != nullptr))
+    if ((Compiler::compJitTimeLogFilename != nullptr) || (JitTimeLogCsv() != nullptr) ||
+        (JitConfig.JitThroughputSummary() != 0))
     {
         pCompJitTimer = JitTimer::Create(this, info.compMethodInfo->ILCodeSize);
     }
@@ -7329,6 +7426,13 @@ int Compiler::compCompileHelper(CORINFO_MODULE_HANDLE classPtr,
             if (canEscapeViaOSR)
             {
                 JITDUMP("\nOSR enabled for this method\n");
+
+                if (compTailPrefixSeen)
+                {
+                    // The importer will not add patchpoints; call counting has to get us out of Tier0.
+                    compReportOSRDeclined(BAD_IL_OFFSET, "OSR can't handle explicit tail calls");
+                }
+
                 if (compHasBackwardJump && !compTailPrefixSeen &&
                     opts.jitFlags->IsSet(JitFlags::JIT_FLAG_BBINSTR_IF_LOOPS) && opts.IsTier0())
                 {
@@ -7341,6 +7445,7 @@ int Compiler::compCompileHelper(CORINFO_MODULE_HANDLE classPtr,
             {
                 JITDUMP("\nOSR disabled for this method: %s\n", reason);
                 assert(reason != nullptr);
+                compReportOSRDeclined(BAD_IL_OFFSET, reason);
             }
         }
 
@@ -9321,6 +9426,74 @@ void JitTimer::PrintCsvMethodStats(Compiler* comp)
     fflush(s_csvFile);
 }
 
+//------------------------------------------------------------------------
+// ReportThroughputSummary: Report a compact summary of the time spent compiling
+//    this method back to the EE, so that it can be surfaced (e.g. as an
+//    EventPipe event) in release builds.
+//
+// Arguments:
+//    comp - the compiler instance
+//
+// Notes:
+//    Only leaf phases are considered when picking the most expensive phases,
+//    since the time of parent phases is the sum of their children.
+//
+void JitTimer::ReportThroughputSummary(Compiler* comp)
+{
+    if (m_info.m_timerFailure)
+    {
+        return;
+    }
+
+    CorJitThroughputSummary summary = {};
+    summary.ilCodeSize              = comp->info.compILCodeSize;
+    summary.nativeCodeSize          = comp->info.compNativeCodeSize;
+
+    const double cyclesPerMicrosecond = CachedCyclesPerSecond() / 1000000.0;
+    if (cyclesPerMicrosecond <= 0.0)
+    {
+        return;
+    }
+
+    uint64_t totCycles                                   = 0;
+    uint64_t topCycles[CORJIT_THROUGHPUT_SUMMARY_PHASES] = {};
+    for (int i = 0; i < PHASE_NUMBER_OF; i++)
+    {
+        if (PhaseHasChildren[i])
+        {
+            continue;
+        }
+
+        uint64_t const cycles = m_info.m_cyclesByPhase[i];
+        totCycles += cycles;
+
+        if ((cycles == 0) || (cycles <= topCycles[CORJIT_THROUGHPUT_SUMMARY_PHASES - 1]))
+        {
+            continue;
+        }
+
+        // Insert into the sorted list of most expensive phases.
+        unsigned slot = CORJIT_THROUGHPUT_SUMMARY_PHASES - 1;
+        while ((slot > 0) && (cycles > topCycles[slot - 1]))
+        {
+            topCycles[slot]          = topCycles[slot - 1];
+            summary.phaseNames[slot] = summary.phaseNames[slot - 1];
+            slot--;
+        }
+
+        topCycles[slot]          = cycles;
+        summary.phaseNames[slot] = PhaseNames[i];
+    }
+
+    summary.totalMicroseconds = (uint64_t)(totCycles / cyclesPerMicrosecond);
+    for (unsigned i = 0; i < CORJIT_THROUGHPUT_SUMMARY_PHASES; i++)
+    {
+        summary.phaseMicroseconds[i] = (uint64_t)(topCycles[i] / cyclesPerMicrosecond);
+    }
+
+    comp->info.compCompHnd->reportMetadata("ThroughputSummary", &summary, sizeof(summary));
+}
+
 // Perform process shutdown actions.
 //
 // static
@@ -9339,6 +9512,11 @@ void JitTimer::Terminate(Compiler* comp, CompTimeSummaryInfo& sum, bool includeP
     if (includePhases)
     {
         PrintCsvMethodStats(comp);
+
+        if (JitConfig.JitThroughputSummary() != 0)
+        {
+            ReportThroughputSummary(comp);
+        }
     }
 
     sum.AddInfo(m_info, includePhases);
@@ -10734,6 +10912,53 @@ bool Compiler::lvaIsOSRLocal(unsigned varNum)
     return varDsc->lvIsOSRLocal;
 }
 
+//------------------------------------------------------------------------
+// lvaIsPatchpointLocal: check if this local var is one that an OSR method
+//     reads from its stack home when transitioning at a patchpoint.
+//
+// Arguments:
+//    varNum     - variable of interest
+//
+// Return Value:
+//    true       - the method has patchpoints and this is an IL local or arg,
+//                 its shadow copy, or a field of one of those
+//    false      - otherwise
+//
+// Notes:
+//    This matches the locals generatePatchpointInfo records offsets for.
+//
+bool Compiler::lvaIsPatchpointLocal(unsigned varNum)
+{
+    if (!doesMethodHavePatchpoints() && !doesMethodHavePartialCompilationPatchpoints())
+    {
+        return false;
+    }
+
+    LclVarDsc* const varDsc = lvaGetDesc(varNum);
+    if (varDsc->lvIsStructField)
+    {
+        varNum = varDsc->lvParentLcl;
+    }
+
+    if (varNum < info.compLocalsCount)
+    {
+        return true;
+    }
+
+    if (gsShadowVarInfo != nullptr)
+    {
+        for (unsigned lclNum = 0; lclNum < info.compLocalsCount; lclNum++)
+        {
+            if (gsShadowVarInfo[lclNum].shadowCopy == varNum)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 //------------------------------------------------------------------------------
 // gtTypeForNullCheck: helper to get the most optimal and correct type for nullcheck
 //
@@ -10968,6 +11193,10 @@ void Compiler::EnregisterStats::RecordLocal(const LclVarDsc* varDsc)
                 m_simdUserForcesDep++;
                 break;
 
+            case DoNotEnregisterReason::PatchpointLocal:
+                m_patchpointLocal++;
+                break;
+
             default:
                 unreached();
                 break;
@@ -11095,6 +11324,7 @@ void Compiler::EnregisterStats::Dump(FILE* fout) const
     PRINT_STATS(m_returnSpCheck, notEnreg);
     PRINT_STATS(m_callSpCheck, notEnreg);
     PRINT_STATS(m_simdUserForcesDep, notEnreg);
+    PRINT_STATS(m_patchpointLocal, notEnreg);
 
     fprintf(fout, "\nAddr exposed details:\n");
     if (m_addrExposed == 0)
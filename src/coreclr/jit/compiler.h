@@ -467,6 +467,7 @@ enum class DoNotEnregisterReason
     ReturnSpCheck,         // the local is used to do SP check on return from function
     CallSpCheck,           // the local is used to do SP check on every call
     SimdUserForcesDep,     // a promoted struct was used by a SIMD/HWI node; it must be dependently promoted
+    PatchpointLocal,       // an OSR method may read this local from its stack home at a patchpoint.
     HiddenBufferStructArg, // the argument is a hidden return buffer passed to a method.
 };
 
@@ -1763,6 +1764,7 @@ class JitTimer
     static CritSecObject s_csvLock; // Lock to protect the time log file.
     static FILE*         s_csvFile; // The time log file handle.
     void PrintCsvMethodStats(Compiler* comp);
+    void ReportThroughputSummary(Compiler* comp);
 
 private:
     void* operator new(size_t);
@@ -4035,6 +4037,7 @@ public:
     // True if this is an OSR compilation and this local is potentially
     // located on the original method stack frame.
     bool lvaIsOSRLocal(unsigned varNum);
+    bool lvaIsPatchpointLocal(unsigned varNum);
 
     //------------------------ For splitting types ----------------------------
 
@@ -4230,6 +4233,12 @@ public:
 
         bool CanPromoteStructType(CORINFO_CLASS_HANDLE typeHnd);
         bool TryPromoteStructVar(unsigned lclNum);
+
+        // Fields of the type last passed to CanPromoteStructType.
+        const lvaStructPromotionInfo& GetPromotionInfo() const
+        {
+            return structPromotionInfo;
+        }
         void Clear()
         {
             structPromotionInfo.typeHnd = NO_CLASS_HANDLE;
@@ -6171,6 +6180,8 @@ public:
 
     PhaseStatus fgSetBlockOrder();
     bool fgHasCycleWithoutGCSafePoint();
+    bool fgMarkBackEdgesForGCPoll();
+    bool fgHasHotLoop(weight_t threshold);
 
     template <typename VisitPreorder, typename VisitPostorder, typename VisitEdge, const bool useProfile = false>
     unsigned fgRunDfs(VisitPreorder assignPreorder, VisitPostorder assignPostorder, VisitEdge visitEdge);
@@ -6980,6 +6991,7 @@ public:
     void optCloneLoop(FlowGraphNaturalLoop* loop, LoopCloneContext* context);
     PhaseStatus optUnrollLoops(); // Unrolls loops (needs to have cost info)
     bool optTryUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR);
+    bool optTryPartiallyUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR);
     void optRedirectPrevUnrollIteration(FlowGraphNaturalLoop* loop, BasicBlock* prevTestBlock, BasicBlock* target);
     void optReplaceScalarUsesWithConst(BasicBlock* block, unsigned lclNum, ssize_t cnsVal);
     void        optRemoveRedundantZeroInits();
@@ -7341,6 +7353,7 @@ public:
 #define OMF_HAS_SPECIAL_INTRINSICS             0x00020000 // Method contains special intrinsics expanded in late phases
 #define OMF_HAS_RECURSIVE_TAILCALL             0x00040000 // Method contains recursive tail call
 #define OMF_HAS_EXPANDABLE_CAST                0x00080000 // Method contains casts eligible for late expansion
+#define OMF_HAS_LOOP_GCPOLLS                   0x00100000 // Method relies on loop back edge GC polls instead of full interruptibility
 
     // clang-format on
 
@@ -7467,9 +7480,15 @@ public:
                 return 3;
             }
 
-            // We plan to use 3 for CoreCLR too, but we need to make sure it doesn't regress performance
-            // as CoreCLR heavily relies on Dynamic PGO while for NativeAOT we *usually* don't have it and
-            // can only perform the "exact" devirtualization.
+            // With Dynamic PGO the class and method histograms come from this very process, so
+            // polymorphic call sites with a few dominant targets get a short chain of checks.
+            if (fgPgoSource == ICorJitInfo::PgoSource::Dynamic)
+            {
+                return 3;
+            }
+
+            // Static or no PGO: stick to the dominating type only until we know more guesses
+            // don't regress performance.
             return 1;
         }
 
@@ -7571,6 +7590,8 @@ public:
 
     PhaseStatus optInductionVariables();
 
+    bool optIsScevNeverNegative(ScalarEvolutionContext& scevContext, Scev* scev);
+    bool optRemoveRedundantBoundsChecks(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop);
     bool optMakeLoopDownwardsCounted(ScalarEvolutionContext& scevContext,
                                      FlowGraphNaturalLoop*   loop,
                                      LoopLocalOccurrences*   loopLocals);
@@ -10135,6 +10156,10 @@ public:
 // Default minimum loop block weight required to enable loop alignment.
 #define DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT 3
 
+// With profile data, default minimum average number of iterations per loop entry
+// required to enable loop alignment.
+#define DEFAULT_ALIGN_LOOP_MIN_TRIP_COUNT 8
+
 // By default a loop will be aligned at 32B address boundary to get better
 // performance as per architecture manuals.
 #define DEFAULT_ALIGN_LOOP_BOUNDARY 0x20
@@ -10159,6 +10184,9 @@ public:
         // Minimum weight needed for the first block of a loop to make it a candidate for alignment.
         unsigned short compJitAlignLoopMinBlockWeight;
 
+        // With profile data, minimum average trip count needed to make a loop a candidate for alignment.
+        unsigned short compJitAlignLoopMinTripCount;
+
         // For non-adaptive alignment, address boundary (power of 2) at which loop alignment should
         // be done. By default, 32B.
         unsigned short compJitAlignLoopBoundary;
@@ -10649,6 +10677,12 @@ public:
         return (JitConfig.JitObjectStackAllocation() != 0);
     }
 
+    // Returns true if the object stack allocation may also allocate fixed-size arrays on the stack
+    bool compObjectStackAllocationArray()
+    {
+        return compObjectStackAllocation() && (JitConfig.JitObjectStackAllocationArray() != 0);
+    }
+
     // Returns true if the method requires a PInvoke prolog and epilog
     bool compMethodRequiresPInvokeFrame()
     {
@@ -10668,6 +10702,7 @@ public:
     // Returns true if the jit supports having patchpoints in this method.
     // Optionally, get the reason why not.
     bool compCanHavePatchpoints(const char** reason = nullptr);
+    void compReportOSRDeclined(IL_OFFSET ilOffset, const char* reason);
 
 #if defined(DEBUG)
 
@@ -10884,6 +10919,7 @@ public:
         unsigned m_returnSpCheck;
         unsigned m_callSpCheck;
         unsigned m_simdUserForcesDep;
+        unsigned m_patchpointLocal;
         unsigned m_liveInOutHndlr;
         unsigned m_depField;
         unsigned m_noRegVars;
@@ -11033,6 +11069,7 @@ protected:
     void compSetProcessor();
     void compInitDebuggingInfo();
     void compSetOptimizationLevel();
+    bool compCanEnregLocalsInTier0();
 #if defined(TARGET_ARMARCH) || defined(TARGET_RISCV64)
     bool compRsvdRegCheck(FrameLayoutState curState);
 #endif
@@ -4337,7 +4337,8 @@ bool Compiler::fgVarNeedsExplicitZeroInit(unsigned varNum, bool bbInALoop, bool
 
 inline bool Compiler::PreciseRefCountsRequired()
 {
-    return opts.OptimizationEnabled();
+    // Tier0 code that enregisters locals needs ref counts to pick which ones to track.
+    return opts.OptimizationEnabled() || compEnregLocals();
 }
 
 template <typename TVisitor>
@@ -1061,6 +1061,60 @@ private:
     unsigned depth;
 };
 
+//------------------------------------------------------------------------
+// fgOpcodeMayWriteHeap: Check if an IL opcode may write to the heap, or
+//    otherwise invalidate heap loads the caller made before the call.
+//
+// Arguments:
+//    opcode - the opcode to check
+//
+// Return Value:
+//    true if the opcode is a call, a store through a pointer, a static
+//    field access (which may run a cctor) or a volatile prefix.
+//
+static bool fgOpcodeMayWriteHeap(OPCODE opcode)
+{
+    switch (opcode)
+    {
+        case CEE_CALL:
+        case CEE_CALLVIRT:
+        case CEE_CALLI:
+        case CEE_NEWOBJ:
+        case CEE_JMP:
+        case CEE_STFLD:
+        case CEE_LDSFLD:
+        case CEE_LDSFLDA:
+        case CEE_STSFLD:
+        case CEE_STIND_I:
+        case CEE_STIND_I1:
+        case CEE_STIND_I2:
+        case CEE_STIND_I4:
+        case CEE_STIND_I8:
+        case CEE_STIND_R4:
+        case CEE_STIND_R8:
+        case CEE_STIND_REF:
+        case CEE_STOBJ:
+        case CEE_CPOBJ:
+        case CEE_INITOBJ:
+        case CEE_CPBLK:
+        case CEE_INITBLK:
+        case CEE_STELEM_I:
+        case CEE_STELEM_I1:
+        case CEE_STELEM_I2:
+        case CEE_STELEM_I4:
+        case CEE_STELEM_I8:
+        case CEE_STELEM_R4:
+        case CEE_STELEM_R8:
+        case CEE_STELEM_REF:
+        case CEE_STELEM:
+        case CEE_VOLATILE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
 //------------------------------------------------------------------------
 // fgFindJumpTargets: walk the IL stream, determining jump target offsets
 //
@@ -1095,6 +1149,7 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
     const bool  isForceInline = (info.compFlags & CORINFO_FLG_FORCEINLINE) != 0;
     const bool  isInlining    = compIsForInlining();
     unsigned    retBlocks     = 0;
+    bool        mayWriteHeap  = false;
     int         prefixFlags   = 0;
     bool        preciseScan   = makeInlineObservations && compInlineResult->GetPolicy()->RequiresPreciseScan();
     const bool  resolveTokens = preciseScan;
@@ -1174,6 +1229,11 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
             BADCODE3("Illegal opcode", ": %02X", (int)opcode);
         }
 
+        if (isInlining && !mayWriteHeap)
+        {
+            mayWriteHeap = fgOpcodeMayWriteHeap(opcode);
+        }
+
         if ((opcode >= CEE_LDARG_0 && opcode <= CEE_STLOC_S) || (opcode >= CEE_LDARG && opcode <= CEE_STLOC))
         {
             opts.lvRefCount++;
@@ -2673,6 +2733,16 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
             // as "no-return" if its IL may change.
         }
 
+        // Likewise, if the inline fails, the caller may keep heap loads alive across a call to
+        // a callee that neither writes to the heap nor can trigger a cctor.
+        if (!mayWriteHeap && isInlining && ((info.compFlags & CORINFO_FLG_SYNCH) == 0) &&
+            ((impInlineInfo->inlineCandidateInfo->initClassResult & CORINFO_INITCLASS_USE_HELPER) == 0) &&
+            info.compCompHnd->notifyMethodInfoUsage(impInlineInfo->iciCall->gtCallMethHnd))
+        {
+            JITDUMP("Callee has no heap writes; marking call [%06u]\n", dspTreeID(impInlineInfo->iciCall));
+            impInlineInfo->iciCall->gtCallMoreFlags |= GTF_CALL_M_NO_HEAP_WRITES;
+        }
+
         // If the inline is viable and discretionary, do the
         // profitability screening.
         if (compInlineResult->IsDiscretionaryCandidate())
@@ -973,7 +973,7 @@ bool Compiler::fgDumpFlowGraph(Phases phase, PhasePosition pos)
             {
                 fprintf(fgxFile, "\n            hot=\"true\"");
             }
-            if (block->HasFlag(BBF_HAS_NEWOBJ))
+            if (block->HasAnyFlag(BBF_HAS_NEWOBJ | BBF_HAS_NEWARR))
             {
                 fprintf(fgxFile, "\n            callsNew=\"true\"");
             }
@@ -158,6 +158,14 @@ PhaseStatus Compiler::fgInsertGCPolls()
         fgRenumberBlocks();
     }
 
+    // The back edge polls were placed at PHASE_SET_BLOCK_ORDER. Flow optimizations since then may
+    // have removed a marked block (e.g. an empty latch), leaving a loop with no safe point.
+    if (((optMethodFlags & OMF_HAS_LOOP_GCPOLLS) != 0) && fgHasCycleWithoutGCSafePoint())
+    {
+        JITDUMP("Loop GC polls no longer cover every cycle; marking method as fully interruptible\n");
+        SetInterruptible(true);
+    }
+
     return result;
 }
 
@@ -201,7 +209,7 @@ BasicBlock* Compiler::fgCreateGCPoll(GCPollType pollType, BasicBlock* block)
 
         if (block->HasFlag(BBF_NEEDS_GCPOLL))
         {
-            // This is a block that ends in a tail call; gc probe early.
+            // This is a block that ends in a tail call or a loop back edge; gc probe early.
             //
             newStmt = fgNewStmtAtBeg(block, call);
         }
@@ -3729,7 +3737,19 @@ PhaseStatus Compiler::fgSetBlockOrder()
 
     if (compCanEncodePtrArgCntMax() && fgHasCycleWithoutGCSafePoint())
     {
-        JITDUMP("Marking method as fully interruptible\n");
+        // Prefer explicit polls on the back edges over full interruptibility when
+        // requested; fall back if some cycle could not be covered.
+        if ((JitConfig.JitGCPollLoopBackEdges() == 0) || !fgMarkBackEdgesForGCPoll() ||
+            fgHasCycleWithoutGCSafePoint())
+        {
+            JITDUMP("Marking method as fully interruptible\n");
+            SetInterruptible(true);
+        }
+    }
+    else if (compCanEncodePtrArgCntMax() && (JitConfig.JitInterruptibleHotLoopWeight() > 0) &&
+             opts.OptimizationEnabled() && fgHasHotLoop((weight_t)JitConfig.JitInterruptibleHotLoopWeight()))
+    {
+        JITDUMP("Marking method as fully interruptible because of a hot loop\n");
         SetInterruptible(true);
     }
 
@@ -3914,6 +3934,105 @@ bool Compiler::fgHasCycleWithoutGCSafePoint()
     return false;
 }
 
+//------------------------------------------------------------------------------
+// fgHasHotLoop: Check if the flow graph has a lexical back edge whose target
+// runs at least the given number of times per call of the method.
+//
+// Arguments:
+//   threshold - minimum normalized weight of the loop head, as a multiple of
+//               the method entry weight
+//
+// Returns:
+//   True if such a back edge exists.
+//
+// Notes:
+//   Used to make methods fully interruptible when their loops are hot, so
+//   that threads running them can be suspended anywhere instead of being
+//   hijacked and retried until they reach a call return.
+//
+bool Compiler::fgHasHotLoop(weight_t threshold)
+{
+    BitVecTraits traits(fgBBNumMax + 1, this);
+    BitVec       seen(BitVecOps::MakeEmpty(&traits));
+
+    for (BasicBlock* const block : Blocks())
+    {
+        BitVecOps::AddElemD(&traits, seen, block->bbNum);
+
+        BasicBlockVisit result = block->VisitRegularSuccs(this, [&](BasicBlock* succ) {
+            if (BitVecOps::IsMember(&traits, seen, succ->bbNum) &&
+                (succ->getBBWeight(this) >= threshold * BB_UNITY_WEIGHT))
+            {
+                return BasicBlockVisit::Abort;
+            }
+
+            return BasicBlockVisit::Continue;
+        });
+
+        if (result == BasicBlockVisit::Abort)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// fgMarkBackEdgesForGCPoll: Mark the sources of lexical back edges that are not
+// already GC safe points as needing a GC poll, so that fgInsertGCPolls makes
+// every loop a safe point instead of the method becoming fully interruptible.
+//
+// Returns:
+//   True if any block was marked.
+//
+// Notes:
+//   Every cycle contains at least one edge to a block at or before the source
+//   in layout order. Blocks whose kind fgInsertGCPolls cannot handle are left
+//   alone; the caller re-checks for uncovered cycles.
+//
+bool Compiler::fgMarkBackEdgesForGCPoll()
+{
+    BitVecTraits traits(fgBBNumMax + 1, this);
+    BitVec       seen(BitVecOps::MakeEmpty(&traits));
+    bool         marked = false;
+
+    for (BasicBlock* const block : Blocks())
+    {
+        BitVecOps::AddElemD(&traits, seen, block->bbNum);
+
+        if (block->HasFlag(BBF_GC_SAFE_POINT) || !block->KindIs(BBJ_ALWAYS, BBJ_COND, BBJ_SWITCH))
+        {
+            continue;
+        }
+
+        bool isBackEdgeSource = false;
+        block->VisitRegularSuccs(this, [&](BasicBlock* succ) {
+            if (BitVecOps::IsMember(&traits, seen, succ->bbNum))
+            {
+                isBackEdgeSource = true;
+                return BasicBlockVisit::Abort;
+            }
+
+            return BasicBlockVisit::Continue;
+        });
+
+        if (isBackEdgeSource)
+        {
+            JITDUMP("Marking " FMT_BB " as needs gc poll on a back edge\n", block->bbNum);
+            block->SetFlags(BBF_NEEDS_GCPOLL | BBF_GC_SAFE_POINT);
+            marked = true;
+        }
+    }
+
+    if (marked)
+    {
+        optMethodFlags |= OMF_NEEDS_GCPOLLS | OMF_HAS_LOOP_GCPOLLS;
+    }
+
+    return marked;
+}
+
 /*****************************************************************************/
 
 void Compiler::fgSetStmtSeq(Statement* stmt)
@@ -4175,6 +4175,7 @@ enum GenTreeCallFlags : unsigned int
     GTF_CALL_M_CAST_CAN_BE_EXPANDED    = 0x04000000, // this cast (helper call) can be expanded if it's profitable. To be removed.
     GTF_CALL_M_CAST_OBJ_NONNULL        = 0x08000000, // if we expand this specific cast we don't need to check the input object for null
                                                      // NOTE: if needed, this flag can be removed, and we can introduce new _NONNUL cast helpers
+    GTF_CALL_M_NO_HEAP_WRITES          = 0x10000000, // the callee's IL was scanned and it cannot write to the heap or run a cctor
 };
 
 inline constexpr GenTreeCallFlags operator ~(GenTreeCallFlags a)
@@ -5473,6 +5474,11 @@ struct GenTreeCall final : public GenTree
         return (gtCallMoreFlags & GTF_CALL_M_DOES_NOT_RETURN) != 0;
     }
 
+    bool HasNoHeapWrites() const
+    {
+        return (gtCallMoreFlags & GTF_CALL_M_NO_HEAP_WRITES) != 0;
+    }
+
     bool IsFatPointerCandidate() const
     {
         return (gtCallMoreFlags & GTF_CALL_M_FAT_POINTER_CHECK) != 0;
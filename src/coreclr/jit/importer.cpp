@@ -3635,24 +3635,94 @@ GenTree* Compiler::impImportStaticReadOnlyField(CORINFO_FIELD_HANDLE field, CORI
                 }
 #endif
 
+                bool isAllZeros = true;
                 for (unsigned i = 0; i < totalSize; i++)
                 {
                     if (buffer[i] != 0)
                     {
-                        // Value is not all zeroes - bail out.
-                        // Although, We might eventually support that too.
-                        JITDUMP("value is not all zeros - bail out.");
+                        isAllZeros = false;
+                        break;
+                    }
+                }
+
+                if (isAllZeros)
+                {
+                    JITDUMP("Success! Optimizing to STORE_LCL_VAR<struct>(0).");
+                    unsigned structTempNum = lvaGrabTemp(true DEBUGARG("folding static readonly field empty struct"));
+                    lvaSetStruct(structTempNum, fieldClsHnd, false);
+
+                    impStoreToTemp(structTempNum, gtNewIconNode(0), CHECK_SPILL_NONE);
+
+                    return gtNewLclVarNode(structTempNum);
+                }
+
+                // Otherwise, we can still fold structs made of a few primitive fields,
+                // e.g. a readonly config struct, by storing each field's constant value.
+                const unsigned MaxFieldsCnt = 8;
+                if ((fieldsCnt == 0) || (fieldsCnt > MaxFieldsCnt) || typGetObjLayout(fieldClsHnd)->HasGCPtr())
+                {
+                    JITDUMP("value is not all zeros and struct has too many or GC fields - bail out.");
+                    return nullptr;
+                }
+
+                static_assert_no_msg(MaxStructSize <= sizeof(uint64_t) * BITS_PER_BYTE);
+                var_types innerFieldTypes[MaxFieldsCnt];
+                unsigned  innerFieldOffsets[MaxFieldsCnt];
+                uint64_t  coveredBytes = 0;
+
+                for (unsigned i = 0; i < fieldsCnt; i++)
+                {
+                    CORINFO_FIELD_HANDLE innerField = info.compCompHnd->getFieldInClass(fieldClsHnd, i);
+                    CORINFO_CLASS_HANDLE innerFieldClsHnd;
+                    innerFieldTypes[i] =
+                        JITtype2varType(info.compCompHnd->getFieldType(innerField, &innerFieldClsHnd, fieldClsHnd));
+                    innerFieldOffsets[i] = info.compCompHnd->getFieldOffset(innerField);
+
+                    if (!varTypeIsIntegral(innerFieldTypes[i]) && !varTypeIsFloating(innerFieldTypes[i]))
+                    {
+                        JITDUMP("struct has non-primitive fields - bail out.");
                         return nullptr;
                     }
+
+                    const unsigned fieldSize = genTypeSize(innerFieldTypes[i]);
+                    if ((innerFieldOffsets[i] + fieldSize) > totalSize)
+                    {
+                        JITDUMP("struct has complex layout - bail out.");
+                        return nullptr;
+                    }
+
+                    const uint64_t fieldBytes = (((uint64_t)1 << fieldSize) - 1) << innerFieldOffsets[i];
+                    if ((coveredBytes & fieldBytes) != 0)
+                    {
+                        JITDUMP("struct has overlapping fields - bail out.");
+                        return nullptr;
+                    }
+                    coveredBytes |= fieldBytes;
                 }
 
-                JITDUMP("Success! Optimizing to STORE_LCL_VAR<struct>(0).");
-                unsigned structTempNum = lvaGrabTemp(true DEBUGARG("folding static readonly field empty struct"));
+                unsigned structTempNum = lvaGrabTemp(true DEBUGARG("folding static readonly field struct"));
                 lvaSetStruct(structTempNum, fieldClsHnd, false);
 
-                impStoreToTemp(structTempNum, gtNewIconNode(0), CHECK_SPILL_NONE);
+                // Zero the padding, so the temp matches the static bit for bit.
+                if (coveredBytes != ((totalSize == 64) ? UINT64_MAX : (((uint64_t)1 << totalSize) - 1)))
+                {
+                    impStoreToTemp(structTempNum, gtNewIconNode(0), CHECK_SPILL_NONE);
+                }
+
+                for (unsigned i = 0; i < fieldsCnt; i++)
+                {
+                    GenTree* constValTree = gtNewGenericCon(innerFieldTypes[i], buffer + innerFieldOffsets[i]);
+                    assert(constValTree != nullptr);
+
+                    GenTree* fieldStoreTree =
+                        gtNewStoreLclFldNode(structTempNum, innerFieldTypes[i], innerFieldOffsets[i], constValTree);
+                    impAppendTree(fieldStoreTree, CHECK_SPILL_NONE, impCurStmtDI);
+                }
+
+                JITDUMP("Folding 'static readonly %s' field to %u STORE_LCL_FLD(CNS) nodes\n",
+                        eeGetClassName(fieldClsHnd), fieldsCnt);
 
-                return gtNewLclVarNode(structTempNum);
+                return impCreateLocalNode(structTempNum DEBUGARG(0));
             }
 
             JITDUMP("getStaticFieldContent returned false - bail out.");
@@ -5870,7 +5940,7 @@ void Compiler::impImportBlockCode(BasicBlock* block)
 
                                 // We may already have decided to put a patchpoint in succBlock. If not, add one.
                                 //
-                                if (succBlock->HasFlag(BBF_PATCHPOINT))
+                                if (!succBlock->HasFlag(BBF_PATCHPOINT))
                                 {
                                     // In some cases the target may not be stack-empty at entry.
                                     // If so, we will bypass patchpoints for this backedge.
@@ -5880,6 +5950,8 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                                         JITDUMP("\nCan't set source patchpoint at " FMT_BB ", can't use target " FMT_BB
                                                 " as it has non-empty stack on entry.\n",
                                                 block->bbNum, succBlock->bbNum);
+                                        compReportOSRDeclined(succBlock->bbCodeOffs,
+                                                              "loop has no stack-empty patchpoint site");
                                     }
                                     else
                                     {
@@ -9527,6 +9599,7 @@ void Compiler::impImportBlockCode(BasicBlock* block)
 
                 // Remember that this function contains 'new' of an SD array.
                 optMethodFlags |= OMF_HAS_NEWARRAY;
+                block->SetFlags(BBF_HAS_NEWARR);
 
                 /* Push the result of the call on the stack */
 
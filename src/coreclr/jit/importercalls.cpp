@@ -6716,20 +6716,54 @@ void Compiler::pickGDV(GenTreeCall*           call,
         }
     }
 
-    if (numberOfMethods > 0)
+    if ((*candidatesCount == 0) && (numberOfMethods > 0))
     {
-        // For method guessing we only support a single target for now
-        unsigned likelihoodThreshold = 30;
-        if (likelyMethods[0].likelihood >= likelihoodThreshold)
+        const int maxNumberOfGuesses = getGDVMaxTypeChecks();
+        if (maxNumberOfGuesses == 0)
         {
-            methodGuesses[0] = (CORINFO_METHOD_HANDLE)likelyMethods[0].handle;
-            likelihoods[0]   = likelyMethods[0].likelihood;
-            *candidatesCount = 1;
             return;
         }
 
-        JITDUMP("Not guessing for method; likelihood is below %s call threshold %u\n",
-                call->IsDelegateInvoke() ? "delegate" : "virtual", likelihoodThreshold);
+        assert((maxNumberOfGuesses > 0) && (maxNumberOfGuesses <= MAX_GDV_TYPE_CHECKS));
+
+        // Use the same scheme as for classes: the more guesses we're allowed
+        // to make, the less likely each of them has to be.
+        unsigned likelihoodThreshold;
+        if (maxNumberOfGuesses == 1)
+        {
+            likelihoodThreshold = 30;
+        }
+        else if (maxNumberOfGuesses == 2)
+        {
+            likelihoodThreshold = 20;
+        }
+        else
+        {
+            likelihoodThreshold = 10;
+        }
+
+        unsigned totalGuesses = min((unsigned)maxNumberOfGuesses, numberOfMethods);
+        for (unsigned guessIdx = 0; guessIdx < totalGuesses; guessIdx++)
+        {
+            if (likelyMethods[guessIdx].likelihood < likelihoodThreshold)
+            {
+                // The candidates are sorted by likelihood so the rest of the
+                // guesses will have even lower likelihoods
+                break;
+            }
+
+            methodGuesses[guessIdx] = (CORINFO_METHOD_HANDLE)likelyMethods[guessIdx].handle;
+            likelihoods[guessIdx]   = likelyMethods[guessIdx].likelihood;
+            *candidatesCount        = *candidatesCount + 1;
+            JITDUMP("Accepting method %s with likelihood %u as a candidate\n",
+                    eeGetMethodFullName(methodGuesses[guessIdx]), likelihoods[guessIdx])
+        }
+
+        if (*candidatesCount == 0)
+        {
+            JITDUMP("Not guessing for method; likelihood is below %s call threshold %u\n",
+                    call->IsDelegateInvoke() ? "delegate" : "virtual", likelihoodThreshold);
+        }
     }
 }
 
@@ -7018,9 +7052,6 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
 
         if (likelyClass == NO_CLASS_HANDLE)
         {
-            // We don't support multiple candidates for method guessing yet.
-            assert(candidateId == 0);
-
             // For method GDV do a few more checks that we get for free in the
             // resolve call above for class-based GDV.
             if ((likelyMethodAttribs & CORINFO_FLG_STATIC) != 0)
@@ -861,6 +861,372 @@ bool Compiler::optWidenPrimaryIV(FlowGraphNaturalLoop* loop,
     return true;
 }
 
+//------------------------------------------------------------------------
+// optSplitScevOffset: Split a SCEV into a base and a constant offset.
+//
+// Parameters:
+//   scev   - The SCEV
+//   base   - [out] The base, or nullptr if the SCEV is a constant
+//   offset - [out] The constant offset
+//
+// Returns:
+//   True if the SCEV could be split; false if the offset does not fit in an int.
+//
+static bool optSplitScevOffset(Compiler* comp, Scev* scev, Scev** base, int64_t* offset)
+{
+    int64_t cns;
+    if (scev->GetConstantValue(comp, &cns))
+    {
+        *base   = nullptr;
+        *offset = cns;
+    }
+    else if (scev->OperIs(ScevOper::Add) && ((ScevBinop*)scev)->Op2->GetConstantValue(comp, &cns))
+    {
+        *base   = ((ScevBinop*)scev)->Op1;
+        *offset = cns;
+    }
+    else
+    {
+        *base   = scev;
+        *offset = 0;
+    }
+
+    return FitsIn<int32_t>(*offset);
+}
+
+//------------------------------------------------------------------------
+// optIsScevNeverNegative: Check if a loop-invariant SCEV is known to be
+// non-negative.
+//
+// Parameters:
+//   scevContext - Context for scalar evolution
+//   scev        - The SCEV
+//
+// Returns:
+//   True if the value is known to be non-negative.
+//
+bool Compiler::optIsScevNeverNegative(ScalarEvolutionContext& scevContext, Scev* scev)
+{
+    int64_t cns;
+    if (scev->GetConstantValue(this, &cns))
+    {
+        return cns >= 0;
+    }
+
+    ValueNum vn = scevContext.MaterializeVN(scev);
+    return (vn != ValueNumStore::NoVN) && vnStore->IsVNNeverNegative(vn);
+}
+
+//------------------------------------------------------------------------
+// optRemoveRedundantBoundsChecks: Remove bounds checks in a counted loop
+// whose index is an induction variable that provably stays within the
+// length being checked.
+//
+// Parameters:
+//   scevContext - Context for scalar evolution
+//   loop        - The loop
+//
+// Returns:
+//   True if any bounds check was removed.
+//
+// Remarks:
+//   The loop must have a single exit whose test is of the form "t < limit"
+//   (or "t <= limit") for an add recurrence t stepping by one, where limit
+//   is "len + c" for a constant c. The exiting block must run exactly once per
+//   iteration before any backedge. For every bounds check "BOUNDS_CHECK(i, len)"
+//   in the loop where i is also an add recurrence stepping by one, i is
+//   "t + d" for a constant d. This lets range check elimination work for
+//   secondary IVs, as in "for (i = 0; i < span.Length - 1; i++) use(span[i + 1])",
+//   where RangeCheck cannot relate the index to the limit.
+//
+//   If the exiting block dominates the check and exits before reaching it
+//   within the iteration, then "t < limit" holds at the check. Otherwise the
+//   test only held in the previous iteration, which gives "t <= limit"
+//   after the step. The first iteration must then be handled by proving
+//   "start < len" from dominating conditions.
+//
+bool Compiler::optRemoveRedundantBoundsChecks(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop)
+{
+    JITDUMP("Checking for redundant bounds checks in " FMT_LP "\n", loop->GetIndex());
+
+    if (loop->ExitEdges().size() != 1)
+    {
+        JITDUMP("  No; has multiple exits\n");
+        return false;
+    }
+
+    BasicBlock* exiting = loop->ExitEdge(0)->getSourceBlock();
+    if (!exiting->KindIs(BBJ_COND))
+    {
+        JITDUMP("  No; exit is not BBJ_COND\n");
+        return false;
+    }
+
+    if (loop->MayExecuteBlockMultipleTimesPerIteration(exiting))
+    {
+        JITDUMP("  No; exiting block may be executed multiple times per iteration\n");
+        return false;
+    }
+
+    if (m_domTree == nullptr)
+    {
+        m_domTree = FlowGraphDominatorTree::Build(m_dfsTree);
+    }
+
+    for (FlowEdge* backedge : loop->BackEdges())
+    {
+        if (!m_domTree->Dominates(exiting, backedge->getSourceBlock()))
+        {
+            JITDUMP("  No; exiting block " FMT_BB " does not dominate backedge source " FMT_BB "\n", exiting->bbNum,
+                    backedge->getSourceBlock()->bbNum);
+            return false;
+        }
+    }
+
+    GenTree* cond = exiting->lastStmt()->GetRootNode()->gtGetOp1();
+    if (!cond->OperIs(GT_LT, GT_LE, GT_GT, GT_GE) || cond->IsUnsigned() || !cond->gtGetOp1()->TypeIs(TYP_INT) ||
+        !cond->gtGetOp2()->TypeIs(TYP_INT))
+    {
+        JITDUMP("  No; exit test is not a signed int relop\n");
+        return false;
+    }
+
+    Scev* op1 = scevContext.Analyze(exiting, cond->gtGetOp1());
+    Scev* op2 = scevContext.Analyze(exiting, cond->gtGetOp2());
+    if ((op1 == nullptr) || (op2 == nullptr))
+    {
+        JITDUMP("  No; could not analyze exit test operands\n");
+        return false;
+    }
+
+    op1 = scevContext.Simplify(op1);
+    op2 = scevContext.Simplify(op2);
+
+    // Phrase the test as the condition under which the loop continues, with
+    // the add recurrence on the left.
+    BasicBlock* const exitingSucc = loop->ContainsBlock(exiting->GetTrueTarget()) ? exiting->GetTrueTarget()
+                                                                                   : exiting->GetFalseTarget();
+    genTreeOps continueOper = cond->OperGet();
+    if (exitingSucc != exiting->GetTrueTarget())
+    {
+        continueOper = GenTree::ReverseRelop(continueOper);
+    }
+
+    GenTree* limitTree = cond->gtGetOp2();
+    if (op2->OperIs(ScevOper::AddRec))
+    {
+        std::swap(op1, op2);
+        continueOper = GenTree::SwapRelop(continueOper);
+        limitTree    = cond->gtGetOp1();
+    }
+
+    int64_t testStep;
+    if (!op1->OperIs(ScevOper::AddRec) || !op2->IsInvariant() ||
+        !((ScevAddRec*)op1)->Step->GetConstantValue(this, &testStep) || (testStep != 1))
+    {
+        JITDUMP("  No; exit test is not a unit-stride IV compared against an invariant\n");
+        return false;
+    }
+
+    if ((continueOper != GT_LT) && (continueOper != GT_LE))
+    {
+        JITDUMP("  No; loop does not continue on t < limit or t <= limit\n");
+        return false;
+    }
+
+    ScevAddRec* const testIV = (ScevAddRec*)op1;
+    Scev*             testBase;
+    int64_t           testOffset;
+    if (!optSplitScevOffset(this, testIV->Start, &testBase, &testOffset))
+    {
+        return false;
+    }
+
+    const ValueNum limitVN = vnStore->VNConservativeNormalValue(limitTree->gtVNPair);
+
+    // Checks dominated by the in-loop successor of the exit test (when that is
+    // not the header) run after the test passed in the same iteration.
+    const bool checksCanFollowTest = (exitingSucc != loop->GetHeader());
+
+    struct BoundsCheckUse
+    {
+        GenTreeBoundsChk* Check;
+        GenTree*          Comma;
+        Statement*        Stmt;
+    };
+
+    ArrayStack<BoundsCheckUse> removable(getAllocator(CMK_LoopOpt));
+
+    loop->VisitLoopBlocksReversePostOrder([&](BasicBlock* block) {
+        for (Statement* const stmt : block->Statements())
+        {
+            for (GenTree* const tree : stmt->TreeList())
+            {
+                GenTree* comma = nullptr;
+                GenTree* node  = tree;
+                if (tree->OperIs(GT_COMMA))
+                {
+                    comma = tree;
+                    node  = tree->gtGetOp1();
+                }
+                else if (tree != stmt->GetRootNode())
+                {
+                    continue;
+                }
+
+                if (!node->OperIs(GT_BOUNDS_CHECK) || !node->AsBoundsChk()->GetIndex()->TypeIs(TYP_INT))
+                {
+                    continue;
+                }
+
+                GenTreeBoundsChk* const check = node->AsBoundsChk();
+
+                Scev* index = scevContext.Analyze(block, check->GetIndex());
+                if (index == nullptr)
+                {
+                    continue;
+                }
+
+                index = scevContext.Simplify(index);
+
+                int64_t indexStep;
+                if (!index->OperIs(ScevOper::AddRec) ||
+                    !((ScevAddRec*)index)->Step->GetConstantValue(this, &indexStep) || (indexStep != 1))
+                {
+                    continue;
+                }
+
+                Scev* const indexStart = ((ScevAddRec*)index)->Start;
+                Scev*       indexBase;
+                int64_t     indexOffset;
+                if (!optSplitScevOffset(this, indexStart, &indexBase, &indexOffset))
+                {
+                    continue;
+                }
+
+                // The index and the test IV must start from the same base so that
+                // they differ by a constant in every iteration.
+                bool sameBase = (indexBase == testBase);
+                if (!sameBase && (indexBase != nullptr) && (testBase != nullptr) &&
+                    indexBase->OperIs(ScevOper::Local) && testBase->OperIs(ScevOper::Local))
+                {
+                    ScevLocal* const indexLcl = (ScevLocal*)indexBase;
+                    ScevLocal* const testLcl  = (ScevLocal*)testBase;
+                    sameBase = (indexLcl->LclNum == testLcl->LclNum) && (indexLcl->SsaNum == testLcl->SsaNum);
+                }
+
+                if (!sameBase)
+                {
+                    continue;
+                }
+
+                const int64_t delta = indexOffset - testOffset;
+
+                // Express the limit as "len + c".
+                const ValueNum lenVN = vnStore->VNConservativeNormalValue(check->GetArrayLength()->gtVNPair);
+                int64_t        limitOffset;
+                VNFuncApp      limitFunc;
+                if (limitVN == lenVN)
+                {
+                    limitOffset = 0;
+                }
+                else if (vnStore->GetVNFunc(limitVN, &limitFunc) &&
+                         ((limitFunc.m_func == VNF_ADD) || (limitFunc.m_func == VNF_SUB)) &&
+                         (limitFunc.m_args[0] == lenVN) && vnStore->IsVNInt32Constant(limitFunc.m_args[1]))
+                {
+                    limitOffset = vnStore->ConstantValue<int32_t>(limitFunc.m_args[1]);
+                    if (limitFunc.m_func == VNF_SUB)
+                    {
+                        limitOffset = -limitOffset;
+                    }
+                }
+                else if (vnStore->GetVNFunc(limitVN, &limitFunc) && (limitFunc.m_func == VNF_ADD) &&
+                         (limitFunc.m_args[1] == lenVN) && vnStore->IsVNInt32Constant(limitFunc.m_args[0]))
+                {
+                    limitOffset = vnStore->ConstantValue<int32_t>(limitFunc.m_args[0]);
+                }
+                else
+                {
+                    continue;
+                }
+
+                // "t <= len + c" is "t < len + c + 1". Since len is non-negative,
+                // requiring the adjusted offset to be non-positive ensures that
+                // computing the limit did not overflow.
+                if (continueOper == GT_LE)
+                {
+                    limitOffset++;
+                }
+
+                if (limitOffset > 0)
+                {
+                    continue;
+                }
+
+                // The index is bounded below by its start. When the index trails the
+                // test IV we also need the test IV start to be non-negative so that
+                // "start + delta" cannot wrap around.
+                if (!optIsScevNeverNegative(scevContext, indexStart) ||
+                    ((delta < 0) && !optIsScevNeverNegative(scevContext, testIV->Start)))
+                {
+                    continue;
+                }
+
+                bool inRange;
+                if (checksCanFollowTest && (block != exiting) && m_domTree->Dominates(exitingSucc, block) &&
+                    m_domTree->Dominates(exiting, block))
+                {
+                    // t < len + c holds at the check, so i = t + delta < len + c + delta.
+                    inRange = (limitOffset + delta) <= 0;
+                }
+                else
+                {
+                    // t <= len + c holds from the second iteration onwards, and the
+                    // first iteration needs "start < len" to hold on entry.
+                    inRange = ((limitOffset + delta) <= -1);
+
+                    if (inRange)
+                    {
+                        ValueNum startVN = scevContext.MaterializeVN(indexStart);
+                        inRange          = (startVN != ValueNumStore::NoVN);
+
+                        if (inRange)
+                        {
+                            ValueNum relop = vnStore->VNForFunc(TYP_INT, VNF_LT, startVN, lenVN);
+                            inRange        = scevContext.EvaluateRelop(relop) == RelopEvaluationResult::True;
+                        }
+                    }
+                }
+
+                if (inRange)
+                {
+                    JITDUMP("  Bounds check [%06u] in " FMT_BB " is redundant: index is the exit IV %+lld\n",
+                            dspTreeID(check), block->bbNum, (long long)delta);
+                    removable.Push({check, comma, stmt});
+                }
+            }
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    if (removable.Height() == 0)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < removable.Height(); i++)
+    {
+        BoundsCheckUse& use = removable.BottomRef(i);
+        optRemoveRangeCheck(use.Check, use.Comma, use.Stmt);
+        gtSetStmtInfo(use.Stmt);
+        fgSetStmtSeq(use.Stmt);
+    }
+
+    Metrics.BoundsChecksRemovedByIVs += removable.Height();
+    return true;
+}
+
 //------------------------------------------------------------------------
 // optMakeLoopDownwardsCounted: Transform a loop to be downwards counted if
 // profitable and legal.
@@ -1199,6 +1565,11 @@ PhaseStatus Compiler::optInductionVariables()
             continue;
         }
 
+        if (optRemoveRedundantBoundsChecks(scevContext, loop))
+        {
+            changed = true;
+        }
+
         if (optMakeLoopDownwardsCounted(scevContext, loop, &loopLocals))
         {
             Metrics.LoopsMadeDownwardsCounted++;
@@ -1447,6 +1447,10 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
             }
             break;
         }
+        case InlineObservation::CALLSITE_WEIGHT:
+            m_CallSiteWeight = static_cast<unsigned>(value);
+            break;
+
         default:
             DefaultPolicy::NoteInt(obs, value);
             break;
@@ -1794,6 +1798,29 @@ double ExtendedDefaultPolicy::DetermineMultiplier()
             multiplier *= min(m_ProfileFrequency, 1.0) * profileScale;
         }
         JITDUMP("\nCallsite has profile data: %g.  Multiplier limited to %g.", m_ProfileFrequency, multiplier);
+
+        // The frequency above is relative to the caller's entry. With trusted (dynamic) profile
+        // data the block weights are raw counts, so the call site weight also tells how hot this
+        // call graph edge is for the whole process: give hot edges more room and take some away
+        // from callers that were barely called while they were instrumented.
+        if (m_RootCompiler->fgHaveTrustedProfileWeights())
+        {
+            const unsigned hotEdgeCount    = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyHotEdgeCount());
+            const unsigned coldCallerCount = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyColdCallerCount());
+
+            if ((hotEdgeCount > 0) && (m_CallSiteWeight >= hotEdgeCount))
+            {
+                multiplier *= 1.5;
+                JITDUMP("\nCallsite was executed %u times (hot edge).  Multiplier increased to %g.", m_CallSiteWeight,
+                        multiplier);
+            }
+            else if ((m_RootCompiler->fgCalledCount < coldCallerCount) && (m_ProfileFrequency <= 1.0))
+            {
+                multiplier *= 0.8;
+                JITDUMP("\nCaller was called " FMT_WT " times (cold caller).  Multiplier decreased to %g.",
+                        m_RootCompiler->fgCalledCount, multiplier);
+            }
+        }
     }
 
     // Slow down if there are already too many locals
@@ -1860,6 +1887,7 @@ void ExtendedDefaultPolicy::OnDumpXml(FILE* file, unsigned indent) const
 {
     DefaultPolicy::OnDumpXml(file, indent);
     XATTR_R8(m_ProfileFrequency)
+    XATTR_I4(m_CallSiteWeight)
     XATTR_I4(m_BinaryExprWithCns)
     XATTR_I4(m_ArgCasted)
     XATTR_I4(m_ArgIsStructByValue)
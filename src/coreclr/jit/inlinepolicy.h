@@ -199,6 +199,7 @@ public:
     ExtendedDefaultPolicy(Compiler* compiler, bool isPrejitRoot)
         : DefaultPolicy(compiler, isPrejitRoot)
         , m_ProfileFrequency(0.0)
+        , m_CallSiteWeight(0)
         , m_BinaryExprWithCns(0)
         , m_ArgCasted(0)
         , m_ArgIsStructByValue(0)
@@ -252,6 +253,7 @@ public:
 
 protected:
     double   m_ProfileFrequency;
+    unsigned m_CallSiteWeight;
     unsigned m_BinaryExprWithCns;
     unsigned m_ArgCasted;
     unsigned m_ArgIsStructByValue;
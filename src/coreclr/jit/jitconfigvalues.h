@@ -69,6 +69,9 @@ CONFIG_INTEGER(JitDefaultFill, W("JitDefaultFill"), 0xdd) // In debug builds, in
 // Minimum weight needed for the first block of a loop to make it a candidate for alignment.
 CONFIG_INTEGER(JitAlignLoopMinBlockWeight, W("JitAlignLoopMinBlockWeight"), DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT)
 
+// With profile data, minimum average number of iterations per loop entry needed for alignment.
+CONFIG_INTEGER(JitAlignLoopMinTripCount, W("JitAlignLoopMinTripCount"), DEFAULT_ALIGN_LOOP_MIN_TRIP_COUNT)
+
 // For non-adaptive alignment, minimum loop size (in bytes) for which alignment will be done.
 // Defaults to 3 blocks of 32 bytes chunks = 96 bytes.
 CONFIG_INTEGER(JitAlignLoopMaxCodeSize, W("JitAlignLoopMaxCodeSize"), DEFAULT_MAX_LOOPSIZE_FOR_ALIGN)
@@ -363,6 +366,18 @@ RELEASE_CONFIG_INTEGER(EnableMultiRegLocals, W("EnableMultiRegLocals"), 1)
 // Disables inlining of all methods
 RELEASE_CONFIG_INTEGER(JitNoInline, W("JitNoInline"), 0)
 
+// If set, methods with loops that contain no GC safe point get an explicit GC poll on each
+// loop back edge instead of being made fully interruptible
+RELEASE_CONFIG_INTEGER(JitGCPollLoopBackEdges, W("JitGCPollLoopBackEdges"), 0)
+
+// If non-zero, optimized methods with a loop whose head runs at least this many times per call
+// are made fully interruptible
+RELEASE_CONFIG_INTEGER(JitInterruptibleHotLoopWeight, W("JitInterruptibleHotLoopWeight"), 0)
+
+// If set, hot counted loops with a runtime trip count are duplicated 2 or 4 times, with every
+// copy keeping its own exit test
+RELEASE_CONFIG_INTEGER(JitPartialUnroll, W("JitPartialUnroll"), 0)
+
 // clang-format off
 
 #if defined(TARGET_AMD64) || defined(TARGET_X86)
@@ -529,6 +544,10 @@ RELEASE_CONFIG_INTEGER(JitEnableNoWayAssert, W("JitEnableNoWayAssert"), 1)
 #endif
 RELEASE_CONFIG_INTEGER(JitMinOptsTrackGCrefs, W("JitMinOptsTrackGCrefs"), JitMinOptsTrackGCrefs_Default)
 
+// If nonzero, Tier0 methods without EH enregister up to this many of their
+// most referenced locals, instead of keeping every local on the stack.
+RELEASE_CONFIG_INTEGER(JitMinOptsEnregLocals, W("JitMinOptsEnregLocals"), 0)
+
 // The following should be wrapped inside "#if MEASURE_MEM_ALLOC / #endif", but
 // some files include this one without bringing in the definitions from "jit.h"
 // so we don't always know what the "true" value of that flag should be. For now
@@ -650,11 +669,16 @@ RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, W("JitExtDefaultPolicyMaxBB"),
 // For now, it's only applied for dynamic PGO.
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfTrust, W("JitExtDefaultPolicyProfTrust"), 0x7)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfScale, W("JitExtDefaultPolicyProfScale"), 0x2A)
+// Raw profile count above which a call site counts as a hot call graph edge (0 disables)
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyHotEdgeCount, W("JitExtDefaultPolicyHotEdgeCount"), 10000)
+// Callers whose profiled call count is below this get a smaller inline budget (0 disables)
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyColdCallerCount, W("JitExtDefaultPolicyColdCallerCount"), 30)
 
 RELEASE_CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocation, W("JitObjectStackAllocation"), 0)
+RELEASE_CONFIG_INTEGER(JitObjectStackAllocationArray, W("JitObjectStackAllocationArray"), 1)
 
 RELEASE_CONFIG_INTEGER(JitEECallTimingInfo, W("JitEECallTimingInfo"), 0)
 
@@ -817,6 +841,12 @@ CONFIG_INTEGER(JitDispIns, W("JitDispIns"), 0)
 // Allow to enregister locals with struct type.
 RELEASE_CONFIG_INTEGER(JitEnregStructLocals, W("JitEnregStructLocals"), 1)
 
+// Report a per-method compile time summary (IL size, code size, total and top phase times) to the EE.
+RELEASE_CONFIG_INTEGER(JitThroughputSummary, W("JitThroughputSummary"), 0)
+
+// Allow LSRA to place resolution moves on colder outgoing edges instead of at the end of hot blocks.
+RELEASE_CONFIG_INTEGER(JitLsraColdEdgeResolution, W("JitLsraColdEdgeResolution"), 1)
+
 #undef CONFIG_INTEGER
 #undef CONFIG_STRING
 #undef CONFIG_METHODSET
@@ -31,11 +31,13 @@ JITMETADATAMETRIC(PhysicallyPromotedFields,              int,              0)
 JITMETADATAMETRIC(LoopsFoundDuringOpts,                  int,              0)
 JITMETADATAMETRIC(LoopsCloned,                           int,              0)
 JITMETADATAMETRIC(LoopsUnrolled,                         int,              0)
+JITMETADATAMETRIC(LoopsPartiallyUnrolled,                int,              0)
 JITMETADATAMETRIC(LoopAlignmentCandidates,               int,              0)
 JITMETADATAMETRIC(LoopsAligned,                          int,              0)
 JITMETADATAMETRIC(LoopsIVWidened,                        int,              0)
 JITMETADATAMETRIC(WidenedIVs,                            int,              0)
 JITMETADATAMETRIC(LoopsMadeDownwardsCounted,             int,              0)
+JITMETADATAMETRIC(BoundsChecksRemovedByIVs,              int,              0)
 JITMETADATAMETRIC(VarsInSsa,                             int,              0)
 JITMETADATAMETRIC(HoistedExpressions,                    int,              0)
 JITMETADATAMETRIC(RedundantBranchesEliminated,           int,              JIT_METADATA_HIGHER_IS_BETTER)
@@ -3259,6 +3259,11 @@ void Compiler::lvaSetVarDoNotEnregister(unsigned varNum DEBUGARG(DoNotEnregister
             JITDUMP("Promoted struct used by a SIMD/HWI node\n");
             break;
 
+        case DoNotEnregisterReason::PatchpointLocal:
+            JITDUMP("OSR method may read it from its stack home at a patchpoint\n");
+            assert(doesMethodHavePatchpoints() || doesMethodHavePartialCompilationPatchpoints());
+            break;
+
         default:
             unreached();
             break;
@@ -4156,6 +4161,12 @@ void Compiler::lvaSortByRefCount()
         {
             lvaSetVarDoNotEnregister(lclNum DEBUGARG(DoNotEnregisterReason::NoRegVars));
         }
+        else if (opts.OptimizationDisabled() && lvaIsPatchpointLocal(lclNum))
+        {
+            // Tier0 code that enregisters locals still has to keep everything an
+            // OSR method will pick up on its frame; temps can stay in registers.
+            lvaSetVarDoNotEnregister(lclNum DEBUGARG(DoNotEnregisterReason::PatchpointLocal));
+        }
 #if defined(JIT32_GCENCODER)
         if (UsesFunclets() && lvaIsOriginalThisArg(lclNum) &&
             (info.compMethodInfo->options & CORINFO_GENERICS_CTXT_FROM_THIS) != 0)
@@ -4220,6 +4231,13 @@ void Compiler::lvaSortByRefCount()
 
     lvaTrackedCount = min(trackedCandidateCount, (unsigned)JitConfig.JitMaxLocalsToTrack());
 
+    // Enregistering Tier0 code is meant to be cheap, so only track its most referenced locals.
+    if (opts.OptimizationDisabled())
+    {
+        assert(compEnregLocals());
+        lvaTrackedCount = min(lvaTrackedCount, (unsigned)JitConfig.JitMinOptsEnregLocals());
+    }
+
     // Sort the candidates. In the late liveness passes we want lower tracked
     // indices to be more important variables, so we always do this. In early
     // liveness it does not matter, so we can skip it when we are going to
@@ -271,6 +271,10 @@ void Compiler::fgPerNodeLocalVarLiveness(GenTree* tree)
                     modHeap = false;
                 }
             }
+            else if (call->HasNoHeapWrites())
+            {
+                modHeap = false;
+            }
             if (modHeap)
             {
                 fgCurMemoryUse |= memoryKindSet(GcHeap, ByrefExposed);
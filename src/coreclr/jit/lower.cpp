@@ -1219,9 +1219,10 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
         //
         comp->fgInvalidateSwitchDescMapEntry(afterDefaultCondBlock);
 
-        // Try generating a bit test based switch first,
-        // if that's not possible a jump table based switch will be generated.
-        if (!TryLowerSwitchToBitTest(jumpTab, jumpCnt, targetCnt, afterDefaultCondBlock, switchValue,
+        // Try replacing the switch with a lookup of the constant its cases produce first, then
+        // a bit test based switch. If neither is possible a jump table based switch will be generated.
+        if (!TryLowerSwitchToLookupTable(jumpTab, jumpCnt, afterDefaultCondBlock, switchValue) &&
+            !TryLowerSwitchToBitTest(jumpTab, jumpCnt, targetCnt, afterDefaultCondBlock, switchValue,
                                      defaultLikelihood))
         {
             JITDUMP("Lowering switch " FMT_BB ": using jump table expansion\n", originalSwitchBB->bbNum);
@@ -1481,20 +1482,256 @@ bool Lowering::TryLowerSwitchToBitTest(FlowEdge*   jumpTable[],
     LIR::AsRange(bbSwitch).InsertAfter(switchValue, bitTableIcon, bitTest, jcc);
 #else  // TARGET_XARCH
     //
-    // Fallback to AND(RSZ(bitTable, switchValue), 1)
+    // Fallback to AND(RSZ(bitTable, switchValue), 1). Comparing against zero lets targets
+    // with test-bit-and-branch instructions (such as arm64's tbz/tbnz) use them.
     //
-    GenTree* tstCns = comp->gtNewIconNode(bbSwitch->NextIs(bbCase0) ? 1 : 0, bitTableType);
-    GenTree* shift  = comp->gtNewOperNode(GT_RSZ, bitTableType, bitTableIcon, switchValue);
-    GenTree* one    = comp->gtNewIconNode(1, bitTableType);
-    GenTree* andOp  = comp->gtNewOperNode(GT_AND, bitTableType, shift, one);
-    GenTree* cmp    = comp->gtNewOperNode(GT_EQ, TYP_INT, andOp, tstCns);
-    GenTree* jcc    = comp->gtNewOperNode(GT_JTRUE, TYP_VOID, cmp);
+    GenTree*   tstCns = comp->gtNewIconNode(0, bitTableType);
+    GenTree*   shift  = comp->gtNewOperNode(GT_RSZ, bitTableType, bitTableIcon, switchValue);
+    GenTree*   one    = comp->gtNewIconNode(1, bitTableType);
+    GenTree*   andOp  = comp->gtNewOperNode(GT_AND, bitTableType, shift, one);
+    genTreeOps cmpOp  = bbSwitch->NextIs(bbCase0) ? GT_NE : GT_EQ;
+    GenTree*   cmp    = comp->gtNewOperNode(cmpOp, TYP_INT, andOp, tstCns);
+    GenTree*   jcc    = comp->gtNewOperNode(GT_JTRUE, TYP_VOID, cmp);
     LIR::AsRange(bbSwitch).InsertAfter(switchValue, bitTableIcon, shift, tstCns, one);
     LIR::AsRange(bbSwitch).InsertAfter(one, andOp, cmp, jcc);
 #endif // !TARGET_XARCH
     return true;
 }
 
+//------------------------------------------------------------------------
+// TryLowerSwitchToLookupTable: Attempts to transform a jump table switch whose
+// cases only store a constant to the same local into a computation of that constant.
+//
+// Arguments:
+//    jumpTable - The jump table
+//    jumpCount - The number of blocks in the jump table
+//    bbSwitch - The switch block
+//    switchValue - A LclVar node that provides the switch value
+//
+// Return value:
+//    true if the switch has been lowered to a lookup
+//
+// Notes:
+//    Every case block must consist of a single "lcl = constant" store followed by
+//    a jump to a join block that is common to all cases. The default case has
+//    already been handled by a JTRUE(GT(switchValue, jumpCount - 2)) that LowerSwitch
+//    generates, so the switch value is known to index one of the cases.
+//
+//    If the case values form a linear sequence the store becomes
+//        lcl = switchValue * step + base
+//    Otherwise, if the values fit in a word when packed with a power of 2 bit width
+//    per case, the word acts as a lookup table held in an immediate:
+//        lcl = ((table >> (switchValue * width)) & mask) + min
+//    In both cases the indirect jump, and the branch mispredictions that come with
+//    it, are replaced by a handful of ALU instructions. The case blocks become
+//    unreachable and are removed once lowering is complete.
+//
+bool Lowering::TryLowerSwitchToLookupTable(FlowEdge*   jumpTable[],
+                                           unsigned    jumpCount,
+                                           BasicBlock* bbSwitch,
+                                           GenTree*    switchValue)
+{
+    assert(jumpCount >= 2);
+    assert(bbSwitch->KindIs(BBJ_SWITCH));
+    assert(switchValue->OperIs(GT_LCL_VAR));
+
+    if (comp->opts.OptimizationDisabled())
+    {
+        return false;
+    }
+
+    const unsigned caseCount = jumpCount - 1;
+    unsigned       lclNum    = BAD_VAR_NUM;
+    BasicBlock*    joinBlock = nullptr;
+
+    ArrayStack<int64_t> values(comp->getAllocator(CMK_ArrayStack), caseCount);
+
+    for (unsigned i = 0; i < caseCount; i++)
+    {
+        BasicBlock* const caseBlock = jumpTable[i]->getDestinationBlock();
+
+        if (!caseBlock->KindIs(BBJ_ALWAYS) || caseBlock->TargetIs(caseBlock) ||
+            !BasicBlock::sameEHRegion(bbSwitch, caseBlock) ||
+            !BasicBlock::sameEHRegion(bbSwitch, caseBlock->GetTarget()))
+        {
+            return false;
+        }
+
+        if (joinBlock == nullptr)
+        {
+            joinBlock = caseBlock->GetTarget();
+        }
+        else if (!caseBlock->TargetIs(joinBlock))
+        {
+            return false;
+        }
+
+        // The block must contain nothing but "STORE_LCL_VAR(CNS_INT)".
+        GenTree* store     = nullptr;
+        unsigned nodeCount = 0;
+        for (GenTree* node : LIR::AsRange(caseBlock))
+        {
+            if (!node->OperIs(GT_IL_OFFSET))
+            {
+                store = node;
+                nodeCount++;
+            }
+        }
+
+        if ((nodeCount != 2) || !store->OperIs(GT_STORE_LCL_VAR) || !store->TypeIs(TYP_INT))
+        {
+            return false;
+        }
+
+        GenTree* const data = store->AsLclVar()->Data();
+        if (!data->IsCnsIntOrI() || data->IsIconHandle() || !data->TypeIs(TYP_INT))
+        {
+            return false;
+        }
+
+        if (lclNum == BAD_VAR_NUM)
+        {
+            lclNum = store->AsLclVar()->GetLclNum();
+
+            if (comp->lvaGetDesc(lclNum)->TypeGet() != TYP_INT)
+            {
+                return false;
+            }
+        }
+        else if (store->AsLclVar()->GetLclNum() != lclNum)
+        {
+            return false;
+        }
+
+        values.Push(data->AsIntCon()->IconValue());
+    }
+
+    GenTree* index = switchValue;
+    if (genActualType(switchValue) != TYP_INT)
+    {
+        // The switch value is known to be less than jumpCount here.
+        index = comp->gtNewCastNode(TYP_INT, switchValue, false, TYP_INT);
+    }
+
+    // Check for a linear sequence of values first, it's the cheapest to compute.
+    const int64_t base     = values.Bottom(0);
+    const int64_t step     = (caseCount > 1) ? (values.Bottom(1) - base) : 0;
+    bool          isLinear = true;
+    int64_t       minValue = base;
+    int64_t       maxValue = base;
+
+    for (unsigned i = 0; i < caseCount; i++)
+    {
+        const int64_t value = values.Bottom(i);
+        isLinear &= (value == base + step * (int64_t)i);
+        minValue = min(minValue, value);
+        maxValue = max(maxValue, value);
+    }
+
+    GenTree* value;
+
+    if (isLinear)
+    {
+        JITDUMP("Lowering switch " FMT_BB " to linear lookup: V%02u = index * %lld + %lld\n", bbSwitch->bbNum, lclNum,
+                (long long)step, (long long)base);
+
+        // Since all the values fit in an int, so do the intermediate results modulo 2^32.
+        if (step == 0)
+        {
+            value = comp->gtNewIconNode((ssize_t)base);
+        }
+        else
+        {
+            value = index;
+
+            if (step != 1)
+            {
+                value = comp->gtNewOperNode(GT_MUL, TYP_INT, value, comp->gtNewIconNode((int32_t)step));
+            }
+
+            if (base != 0)
+            {
+                value = comp->gtNewOperNode(GT_ADD, TYP_INT, value, comp->gtNewIconNode((ssize_t)base));
+            }
+        }
+    }
+    else
+    {
+        const uint64_t range    = (uint64_t)(maxValue - minValue);
+        unsigned       bitWidth = 1;
+
+        while ((bitWidth < 32) && ((range >> bitWidth) != 0))
+        {
+            bitWidth *= 2;
+        }
+
+        const unsigned tableBits = caseCount * bitWidth;
+
+        if (tableBits > (genTypeSize(TYP_I_IMPL) * 8))
+        {
+            return false;
+        }
+
+        uint64_t table = 0;
+        for (unsigned i = 0; i < caseCount; i++)
+        {
+            table |= (uint64_t)(values.Bottom(i) - minValue) << (i * bitWidth);
+        }
+
+        JITDUMP("Lowering switch " FMT_BB " to bitmap lookup: V%02u = ((0x%llx >> (index * %u)) & 0x%llx) + %lld\n",
+                bbSwitch->bbNum, lclNum, (unsigned long long)table, bitWidth,
+                (unsigned long long)((uint64_t(1) << bitWidth) - 1),
+                (long long)minValue);
+
+        const var_types tableType = (tableBits <= (genTypeSize(TYP_INT) * 8)) ? TYP_INT : TYP_LONG;
+
+        GenTree* shift = index;
+        if (bitWidth != 1)
+        {
+            shift = comp->gtNewOperNode(GT_LSH, TYP_INT, shift, comp->gtNewIconNode(genLog2(bitWidth)));
+        }
+
+        value = comp->gtNewOperNode(GT_RSZ, tableType, comp->gtNewIconNode((ssize_t)table, tableType), shift);
+
+        if (bitWidth < (genTypeSize(tableType) * 8))
+        {
+            value = comp->gtNewOperNode(GT_AND, tableType, value,
+                                        comp->gtNewIconNode((ssize_t)((uint64_t(1) << bitWidth) - 1), tableType));
+        }
+
+        if (tableType != TYP_INT)
+        {
+            value = comp->gtNewCastNode(TYP_INT, value, false, TYP_INT);
+        }
+
+        if (minValue != 0)
+        {
+            value = comp->gtNewOperNode(GT_ADD, TYP_INT, value, comp->gtNewIconNode((ssize_t)minValue));
+        }
+    }
+
+    // Replace the switch value with the store, which now consumes it.
+    LIR::Range& switchRange = LIR::AsRange(bbSwitch);
+    switchRange.Remove(switchValue);
+    switchRange.InsertAtEnd(LIR::SeqTree(comp, comp->gtNewStoreLclVarNode(lclNum, value)));
+
+    // Rewire the switch block to jump straight to the join block.
+    for (unsigned i = 0; i < caseCount; i++)
+    {
+        BasicBlock* const caseBlock = jumpTable[i]->getDestinationBlock();
+        if (comp->fgGetPredForBlock(caseBlock, bbSwitch) != nullptr)
+        {
+            comp->fgRemoveAllRefPreds(caseBlock, bbSwitch);
+        }
+    }
+
+    FlowEdge* const joinEdge = comp->fgAddRefPred(joinBlock, bbSwitch);
+    joinEdge->setLikelihood(1.0);
+    bbSwitch->SetKindAndTargetEdge(BBJ_ALWAYS, joinEdge);
+
+    return true;
+}
+
 void Lowering::ReplaceArgWithPutArgOrBitcast(GenTree** argSlot, GenTree* putArgOrBitcast)
 {
     assert(argSlot != nullptr);
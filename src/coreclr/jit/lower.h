@@ -387,6 +387,10 @@ private:
                                      BasicBlock* bbSwitch,
                                      GenTree*    switchValue,
                                      weight_t    defaultLikelihood);
+    bool     TryLowerSwitchToLookupTable(FlowEdge*   jumpTable[],
+                                         unsigned    jumpCount,
+                                         BasicBlock* bbSwitch,
+                                         GenTree*    switchValue);
 
     GenTree* LowerCast(GenTree* node);
 
@@ -839,6 +839,9 @@ LinearScan::LinearScan(Compiler* theCompiler)
     // so we don't want to check that yet.
     enregisterLocalVars = compiler->compEnregLocals();
 
+    // Place resolution moves on colder edges, rather than at the end of hot blocks, when optimizing.
+    preferColdEdgeResolution = compiler->opts.OptimizationEnabled() && (JitConfig.JitLsraColdEdgeResolution() != 0);
+
     regSelector = new (theCompiler, CMK_LSRA) RegisterSelection(this);
 
 #ifdef TARGET_ARM64
@@ -8995,6 +8998,44 @@ void LinearScan::addResolution(BasicBlock*       block,
     INTRACK_STATS(updateLsraStat(STAT_RESOLUTION_MOV, block->bbNum));
 }
 
+//------------------------------------------------------------------------
+// isColdResolutionEdge: Determine whether resolution for a var that is live
+//    out of 'block' on only some of its successors should be placed on those
+//    edges rather than at the end of 'block'.
+//
+// Arguments:
+//    block          - the block with outgoing critical edges.
+//    liveSuccWeight - the sum of the weights of the successors at which the var is live.
+//
+// Return Value:
+//    true if 'block' is hot and the successors that need the resolution are
+//    sufficiently colder that splitting those edges is cheaper than placing the
+//    move at the end of 'block'.
+//
+// Notes:
+//    This is effectively splitting the live range at the loop exit: the interval
+//    keeps its register across the hot loop body and is only moved (or spilled)
+//    on the cold exit path.
+//
+bool LinearScan::isColdResolutionEdge(BasicBlock* block, weight_t liveSuccWeight)
+{
+    // Splitting a switch's edges can create many new blocks; leave those alone.
+    if (block->KindIs(BBJ_SWITCH) || block->hasEHBoundaryOut())
+    {
+        return false;
+    }
+
+    if (block->bbWeight <= BB_UNITY_WEIGHT)
+    {
+        return false;
+    }
+
+    // The new block on each split edge costs an extra jump, so require that the
+    // live successors be substantially colder than 'block'.
+    const weight_t coldEdgeRatio = 4.0;
+    return (liveSuccWeight * coldEdgeRatio) < block->bbWeight;
+}
+
 //------------------------------------------------------------------------
 // handleOutgoingCriticalEdges: Performs the necessary resolution on all critical edges that feed out of 'block'
 //
@@ -9162,6 +9203,7 @@ void LinearScan::handleOutgoingCriticalEdges(BasicBlock* block)
         bool      maybeSameLivePaths  = false;
         bool      liveOnlyAtSplitEdge = true;
         regNumber sameToReg           = REG_NA;
+        weight_t  liveSuccWeight      = BB_ZERO_WEIGHT;
         for (unsigned succIndex = 0; succIndex < succCount; succIndex++)
         {
             BasicBlock* succBlock = block->GetSucc(succIndex, compiler);
@@ -9170,7 +9212,10 @@ void LinearScan::handleOutgoingCriticalEdges(BasicBlock* block)
                 maybeSameLivePaths = true;
                 continue;
             }
-            else if (liveOnlyAtSplitEdge)
+
+            liveSuccWeight += succBlock->bbWeight;
+
+            if (liveOnlyAtSplitEdge)
             {
                 // Is the var live only at those target blocks which are connected by a split edge to this block
                 liveOnlyAtSplitEdge =
@@ -9241,6 +9286,19 @@ void LinearScan::handleOutgoingCriticalEdges(BasicBlock* block)
             }
         }
 
+        // If this block is hot (e.g. the exiting block of a loop) and the var is live only on the
+        // colder successors, resolving it at the end of "block" would put the move (often a spill)
+        // on the hot path. Instead, defer it to the individual edges so that the interval stays in
+        // its register in the hot block and the move is done only on the paths that need it.
+        if ((sameToReg != REG_NA) && maybeSameLivePaths && preferColdEdgeResolution &&
+            isColdResolutionEdge(block, liveSuccWeight))
+        {
+            JITDUMP("Deferring resolution of V%02u out of hot " FMT_BB " to its colder edges\n",
+                    compiler->lvaTrackedIndexToLclNum(outResolutionSetVarIndex), block->bbNum);
+            INTRACK_STATS(updateLsraStat(STAT_COLD_EDGE_RESOLUTION, block->bbNum));
+            sameToReg = REG_NA;
+        }
+
         if (sameToReg == REG_NA)
         {
             VarSetOps::AddElemD(compiler, diffResolutionSet, outResolutionSetVarIndex);
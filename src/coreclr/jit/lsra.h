@@ -722,6 +722,7 @@ public:
                            DEBUG_ARG(const char* reason));
 
     void handleOutgoingCriticalEdges(BasicBlock* block);
+    bool isColdResolutionEdge(BasicBlock* block, weight_t liveSuccWeight);
 
     void resolveEdge(BasicBlock*      fromBlock,
                      BasicBlock*      toBlock,
@@ -1701,6 +1702,9 @@ private:
         return enregisterLocalVars;
     }
 
+    // True if resolution moves may be placed on colder outgoing edges rather than at the end of a hot block.
+    bool preferColdEdgeResolution;
+
     // Ordered list of RefPositions
     RefPositionList refPositions;
 
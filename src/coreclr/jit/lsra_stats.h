@@ -26,6 +26,10 @@ LSRA_STAT_DEF(STAT_RESOLUTION_MOV,       "ResolutionMovs")
 // Number of critical edges from this block that are split.
 LSRA_STAT_DEF(STAT_SPLIT_EDGE,           "SplitEdges")
 
+// Number of vars whose resolution was moved off the end of this (hot) block
+// and onto its colder outgoing edges.
+LSRA_STAT_DEF(STAT_COLD_EDGE_RESOLUTION, "ColdEdgeResolutions")
+
 #endif // TRACK_LSRA_STATS
 
 // clang-format on
@@ -26,13 +26,17 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 //    PhaseStatus indicating, what, if anything, was modified
 //
 // Notes:
-//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ set.
+//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ set,
+//    or has flag OMF_HAS_NEWARRAY set and array stack allocation is enabled.
 //
 PhaseStatus ObjectAllocator::DoPhase()
 {
-    if ((comp->optMethodFlags & OMF_HAS_NEWOBJ) == 0)
+    const bool hasNewObj = (comp->optMethodFlags & OMF_HAS_NEWOBJ) != 0;
+    const bool hasNewArr = IsArrayStackAllocationEnabled() && ((comp->optMethodFlags & OMF_HAS_NEWARRAY) != 0);
+
+    if (!hasNewObj && !hasNewArr)
     {
-        JITDUMP("no newobjs in this method; punting\n");
+        JITDUMP("no newobjs or stack-allocatable newarrs in this method; punting\n");
         return PhaseStatus::MODIFIED_NOTHING;
     }
 
@@ -339,7 +343,9 @@ void ObjectAllocator::ComputeStackObjectPointers(BitVecTraits* bitVecTraits)
 //    true if any allocation was done as a stack allocation.
 //
 // Notes:
-//    Runs only over the blocks having bbFlags BBF_HAS_NEWOBJ set.
+//    Runs only over the blocks having bbFlags BBF_HAS_NEWOBJ or BBF_HAS_NEWARR set.
+//    Fixed-size newarr helper calls are considered only when array stack
+//    allocation is enabled; the ones that can't be stack allocated are left as is.
 
 bool ObjectAllocator::MorphAllocObjNodes()
 {
@@ -350,9 +356,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
     for (BasicBlock* const block : comp->Blocks())
     {
         const bool basicBlockHasNewObj       = block->HasFlag(BBF_HAS_NEWOBJ);
+        const bool basicBlockHasNewArr       = block->HasFlag(BBF_HAS_NEWARR) && IsArrayStackAllocationEnabled();
         const bool basicBlockHasBackwardJump = block->HasFlag(BBF_BACKWARD_JUMP);
 #ifndef DEBUG
-        if (!basicBlockHasNewObj)
+        if (!basicBlockHasNewObj && !basicBlockHasNewArr)
         {
             continue;
         }
@@ -364,6 +371,7 @@ bool ObjectAllocator::MorphAllocObjNodes()
             GenTree* data     = nullptr;
 
             bool canonicalAllocObjFound = false;
+            bool canonicalNewArrFound   = false;
 
             if (stmtExpr->OperIs(GT_STORE_LCL_VAR) && stmtExpr->TypeIs(TYP_REF))
             {
@@ -373,9 +381,42 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 {
                     canonicalAllocObjFound = true;
                 }
+                else if (basicBlockHasNewArr && data->IsHelperCall())
+                {
+                    canonicalNewArrFound = true;
+                }
             }
 
-            if (canonicalAllocObjFound)
+            if (canonicalNewArrFound)
+            {
+                //------------------------------------------------------------------------
+                // We are looking for the following expression tree
+                //  STMTx (IL 0x... ???)
+                //    * STORE_LCL_VAR   ref
+                //    \--*  CALL help ref    CORINFO_HELP_NEWARR_1_VC
+                //       +--*  CNS_INT(h) long
+                //       \--*  CNS_INT    long
+                //------------------------------------------------------------------------
+
+                GenTreeCall*       asCall = data->AsCall();
+                const unsigned int lclNum = stmtExpr->AsLclVar()->GetLclNum();
+                unsigned int       blockSize;
+
+                // Don't attempt to do stack allocations inside basic blocks that may be in a loop.
+                if (!basicBlockHasBackwardJump && CanAllocateNewArrOnStack(lclNum, asCall, &blockSize))
+                {
+                    JITDUMP("Allocating array local variable V%02u on the stack\n", lclNum);
+
+                    const unsigned int stackLclNum = MorphNewArrNodeIntoStackAlloc(asCall, blockSize, block, stmt);
+                    m_HeapLocalToStackLocalMap.AddOrUpdate(lclNum, stackLclNum);
+                    MarkLclVarAsDefinitelyStackPointing(lclNum);
+                    MarkLclVarAsPossiblyStackPointing(lclNum);
+                    stmt->GetRootNode()->gtBashToNOP();
+                    comp->optMethodFlags |= OMF_HAS_OBJSTACKALLOC;
+                    didStackAllocate = true;
+                }
+            }
+            else if (canonicalAllocObjFound)
             {
                 assert(basicBlockHasNewObj);
                 //------------------------------------------------------------------------
@@ -548,6 +589,81 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* a
     return lclNum;
 }
 
+//------------------------------------------------------------------------
+// MorphNewArrNodeIntoStackAlloc: Morph a fixed-size newarr helper call into
+//                                stack allocation.
+//
+// Arguments:
+//    newArr       - newarr helper call that will be replaced by a stack allocation
+//    blockSize    - size of the stack memory that holds the array, in bytes
+//    block        - a basic block where newArr is
+//    stmt         - a statement where newArr is
+//
+// Return Value:
+//    local num for the new stack allocated local
+//
+// Notes:
+//    This function can insert additional statements before stmt.
+
+unsigned int ObjectAllocator::MorphNewArrNodeIntoStackAlloc(GenTreeCall* newArr,
+                                                            unsigned int blockSize,
+                                                            BasicBlock*  block,
+                                                            Statement*   stmt)
+{
+    assert(newArr != nullptr);
+    assert(m_AnalysisDone);
+
+    GenTree* const methodTable = newArr->gtArgs.GetUserArgByIndex(0)->GetNode();
+    GenTree* const length      = newArr->gtArgs.GetUserArgByIndex(1)->GetNode();
+
+    const bool         shortLifetime = false;
+    const unsigned int lclNum = comp->lvaGrabTemp(shortLifetime DEBUGARG("MorphNewArrNodeIntoStackAlloc temp"));
+    comp->lvaSetStruct(lclNum, comp->typGetBlkLayout(blockSize), /* unsafeValueClsCheck */ false);
+
+    // Initialize the array memory if necessary.
+    bool             bbInALoop  = block->HasFlag(BBF_BACKWARD_JUMP);
+    bool             bbIsReturn = block->KindIs(BBJ_RETURN);
+    LclVarDsc* const lclDsc     = comp->lvaGetDesc(lclNum);
+    if (comp->fgVarNeedsExplicitZeroInit(lclNum, bbInALoop, bbIsReturn))
+    {
+        GenTree*   init     = comp->gtNewStoreLclVarNode(lclNum, comp->gtNewIconNode(0));
+        Statement* initStmt = comp->gtNewStmt(init);
+
+        comp->fgInsertStmtBefore(block, stmt, initStmt);
+    }
+    else
+    {
+        JITDUMP("\nSuppressing zero-init for V%02u -- expect to zero in prolog\n", lclNum);
+        lclDsc->lvSuppressedZeroInit = 1;
+        comp->compSuppressedZeroInit = true;
+    }
+
+    //------------------------------------------------------------------------
+    // STMTx (IL 0x... ???)
+    //   * STORE_LCL_FLD    long
+    //   \--*  CNS_INT(h) long
+    //
+    // STMTy (IL 0x... ???)
+    //   * STORE_LCL_FLD    int
+    //   \--*  CNS_INT    int
+    //------------------------------------------------------------------------
+
+    // Initialize the method table pointer.
+    GenTree*   init     = comp->gtNewStoreLclFldNode(lclNum, TYP_I_IMPL, 0, methodTable);
+    Statement* initStmt = comp->gtNewStmt(init);
+
+    comp->fgInsertStmtBefore(block, stmt, initStmt);
+
+    // Initialize the array length.
+    GenTree* const lengthValue = comp->gtNewIconNode((ssize_t)length->AsIntConCommon()->IconValue(), TYP_INT);
+    init     = comp->gtNewStoreLclFldNode(lclNum, TYP_INT, OFFSETOF__CORINFO_Array__length, lengthValue);
+    initStmt = comp->gtNewStmt(init);
+
+    comp->fgInsertStmtBefore(block, stmt, initStmt);
+
+    return lclNum;
+}
+
 //------------------------------------------------------------------------
 // CanLclVarEscapeViaParentStack: Check if the local variable escapes via the given parent stack.
 //                                Update the connection graph as necessary.
@@ -621,6 +737,20 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
                 keepChecking = true;
                 break;
 
+            case GT_INDEX_ADDR:
+                if (tree == parent->AsIndexAddr()->Arr())
+                {
+                    // The element address may still escape; check the grandparent.
+                    ++parentIndex;
+                    keepChecking = true;
+                }
+                break;
+
+            case GT_ARR_LENGTH:
+                // Reading the length doesn't make the array escape.
+                canLclVarEscapeViaParentStack = false;
+                break;
+
             case GT_STOREIND:
                 if (tree != parent->AsIndir()->Addr())
                 {
@@ -717,6 +847,13 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
                 keepChecking = true;
                 break;
 
+            case GT_INDEX_ADDR:
+                // The element address is already a byref; only the uses of it need to be updated.
+                assert(tree == parent->AsIndexAddr()->Arr());
+                ++parentIndex;
+                keepChecking = true;
+                break;
+
             case GT_STOREIND:
                 assert(tree == parent->AsIndir()->Addr());
 
@@ -733,6 +870,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
                 break;
 
             case GT_IND:
+            case GT_ARR_LENGTH:
                 break;
 
             default:
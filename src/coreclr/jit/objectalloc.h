@@ -26,6 +26,7 @@ class ObjectAllocator final : public Phase
     //===============================================================================
     // Data members
     bool         m_IsObjectStackAllocationEnabled;
+    bool         m_IsArrayStackAllocationEnabled;
     bool         m_AnalysisDone;
     BitVecTraits m_bitVecTraits;
     BitVec       m_EscapingPointers;
@@ -42,12 +43,15 @@ public:
     ObjectAllocator(Compiler* comp);
     bool IsObjectStackAllocationEnabled() const;
     void EnableObjectStackAllocation();
+    bool IsArrayStackAllocationEnabled() const;
+    void EnableArrayStackAllocation();
 
 protected:
     virtual PhaseStatus DoPhase() override;
 
 private:
     bool         CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd);
+    bool         CanAllocateNewArrOnStack(unsigned int lclNum, GenTreeCall* newArr, unsigned int* blockSize);
     bool         CanLclVarEscape(unsigned int lclNum);
     void         MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
     void         MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
@@ -63,6 +67,10 @@ private:
     void         RewriteUses();
     GenTree*     MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
     unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj, BasicBlock* block, Statement* stmt);
+    unsigned int MorphNewArrNodeIntoStackAlloc(GenTreeCall* newArr,
+                                               unsigned int blockSize,
+                                               BasicBlock*  block,
+                                               Statement*   stmt);
     struct BuildConnGraphVisitorCallbackData;
     bool CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parentStack, unsigned int lclNum);
     void UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* parentStack, var_types newType);
@@ -75,6 +83,7 @@ private:
 inline ObjectAllocator::ObjectAllocator(Compiler* comp)
     : Phase(comp, PHASE_ALLOCATE_OBJECTS)
     , m_IsObjectStackAllocationEnabled(false)
+    , m_IsArrayStackAllocationEnabled(false)
     , m_AnalysisDone(false)
     , m_bitVecTraits(comp->lvaCount, comp)
     , m_HeapLocalToStackLocalMap(comp->getAllocator())
@@ -104,6 +113,28 @@ inline void ObjectAllocator::EnableObjectStackAllocation()
     m_IsObjectStackAllocationEnabled = true;
 }
 
+//------------------------------------------------------------------------
+// IsArrayStackAllocationEnabled: Returns true iff stack allocation of
+//                                fixed-size arrays is enabled
+//
+// Return Value:
+//    Returns true iff array stack allocation is enabled
+
+inline bool ObjectAllocator::IsArrayStackAllocationEnabled() const
+{
+    return m_IsArrayStackAllocationEnabled;
+}
+
+//------------------------------------------------------------------------
+// EnableArrayStackAllocation:        Enable stack allocation of fixed-size arrays.
+//                                    Requires object stack allocation to be enabled.
+
+inline void ObjectAllocator::EnableArrayStackAllocation()
+{
+    assert(m_IsObjectStackAllocationEnabled);
+    m_IsArrayStackAllocationEnabled = true;
+}
+
 //------------------------------------------------------------------------
 // CanAllocateLclVarOnStack: Returns true iff local variable can be
 //                           allocated on the stack.
@@ -140,6 +171,78 @@ inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORIN
     return !CanLclVarEscape(lclNum) && (classSize <= s_StackAllocMaxSize);
 }
 
+//------------------------------------------------------------------------
+// CanAllocateNewArrOnStack: Returns true iff the array allocated by the given
+//                           newarr helper call and stored to the local variable
+//                           can be allocated on the stack.
+//
+// Arguments:
+//    lclNum     - Local variable number the array is stored to
+//    newArr     - newarr helper call
+//    blockSize  - [out] size of the stack memory that would hold the array
+//
+// Return Value:
+//    Returns true iff the array can be allocated on the stack.
+//
+// Notes:
+//    Only arrays of primitive elements with a constant length and an exact
+//    method table handle are considered, so the stack copy never has gc fields.
+
+inline bool ObjectAllocator::CanAllocateNewArrOnStack(unsigned int lclNum, GenTreeCall* newArr, unsigned int* blockSize)
+{
+    assert(m_AnalysisDone);
+    assert(blockSize != nullptr);
+
+    const CorInfoHelpFunc helper = newArr->GetHelperNum();
+
+    // Frozen, 8-byte aligned and object arrays use dedicated helpers; leave those on the heap.
+    if ((helper != CORINFO_HELP_NEWARR_1_VC) && (helper != CORINFO_HELP_NEWARR_1_DIRECT))
+    {
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE clsHnd = (CORINFO_CLASS_HANDLE)newArr->compileTimeHelperArgumentHandle;
+
+    if ((clsHnd == NO_CLASS_HANDLE) || (newArr->gtArgs.CountUserArgs() != 2))
+    {
+        return false;
+    }
+
+    GenTree* const methodTable = newArr->gtArgs.GetUserArgByIndex(0)->GetNode();
+    GenTree* const length      = newArr->gtArgs.GetUserArgByIndex(1)->GetNode();
+
+    if (!methodTable->IsIconHandle(GTF_ICON_CLASS_HDL) || !length->IsCnsIntOrI())
+    {
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE elemClsHnd = NO_CLASS_HANDLE;
+    const CorInfoType    elemType   = comp->info.compCompHnd->getChildType(clsHnd, &elemClsHnd);
+    const var_types      elemTyp    = JITtype2varType(elemType);
+
+    if (!varTypeIsArithmetic(elemTyp))
+    {
+        return false;
+    }
+
+    const ssize_t elemCount = length->AsIntConCommon()->IconValue();
+    if ((elemCount < 0) || (elemCount > (ssize_t)(s_StackAllocMaxSize / genTypeSize(elemTyp))))
+    {
+        return false;
+    }
+
+    const unsigned int size =
+        roundUp(OFFSETOF__CORINFO_Array__data + (unsigned)elemCount * genTypeSize(elemTyp), TARGET_POINTER_SIZE);
+
+    if (CanLclVarEscape(lclNum) || (size > s_StackAllocMaxSize))
+    {
+        return false;
+    }
+
+    *blockSize = size;
+    return true;
+}
+
 //------------------------------------------------------------------------
 // CanLclVarEscape:          Returns true iff local variable can
 //                           potentially escape from the method
@@ -2447,6 +2447,17 @@ void CSE_HeuristicParameterized::GreedyPolicy()
         //
         assert(dsc->IsViable());
 
+#ifdef DEBUG
+        // Honor JitNoCSE2, as the standard heuristic does.
+        //
+        if (m_pCompiler->optConfigDisableCSE2())
+        {
+            // It was purged from sortTab above, so rebuilding the choices drops it.
+            recomputeFeatures = true;
+            continue;
+        }
+#endif
+
         CSE_Candidate candidate(this, dsc);
 
         if (m_verbose)
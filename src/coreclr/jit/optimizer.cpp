@@ -1236,7 +1236,8 @@ bool Compiler::optComputeLoopRep(int        constInit,
 // Loops must be of the form:
 //   for (i=icon; i<icon; i++) { ... }
 //
-// Loops handled are fully unrolled; there is no partial unrolling.
+// Loops handled are fully unrolled. Hot innermost loops whose trip count is
+// not constant may instead be partially unrolled, see optTryPartiallyUnrollLoop.
 //
 // Limitations: only the following loop types are handled:
 // 1. constant initializer, constant bound
@@ -1279,8 +1280,9 @@ PhaseStatus Compiler::optUnrollLoops()
 
     // Look for loop unrolling candidates
 
-    int  unrollCount = 0;
-    bool anyIRchange = false;
+    int  unrollCount        = 0;
+    int  partialUnrollCount = 0;
+    bool anyIRchange        = false;
 
     int passes = 0;
 
@@ -1300,13 +1302,21 @@ PhaseStatus Compiler::optUnrollLoops()
                 continue;
             }
 
-            if (!optTryUnrollLoop(loop, &anyIRchange))
+            if (optTryUnrollLoop(loop, &anyIRchange))
+            {
+                unrollCount++;
+            }
+            else if ((passes == 0) && optTryPartiallyUnrollLoop(loop, &anyIRchange))
+            {
+                // Only try this on the first pass so that a loop gets partially
+                // unrolled at most once.
+                partialUnrollCount++;
+            }
+            else
             {
                 continue;
             }
 
-            unrollCount++;
-
             // Mark in all ancestors now that one of their descendant loops was
             // unrolled to indicate that the set of loop blocks changed.
             for (FlowGraphNaturalLoop* ancestor = loop->GetParent(); ancestor != nullptr;
@@ -1316,7 +1326,8 @@ PhaseStatus Compiler::optUnrollLoops()
             }
         }
 
-        if ((unrollCount == 0) || BitVecOps::IsEmpty(&loopTraits, loopsWithUnrolledDescendant) || (passes >= 10))
+        if (((unrollCount + partialUnrollCount) == 0) || BitVecOps::IsEmpty(&loopTraits, loopsWithUnrolledDescendant) ||
+            (passes >= 10))
         {
             break;
         }
@@ -1329,16 +1340,18 @@ PhaseStatus Compiler::optUnrollLoops()
         passes++;
     }
 
-    if (unrollCount > 0)
+    if ((unrollCount + partialUnrollCount) > 0)
     {
         assert(anyIRchange);
 
         Metrics.LoopsUnrolled += unrollCount;
+        Metrics.LoopsPartiallyUnrolled += partialUnrollCount;
 
 #ifdef DEBUG
         if (verbose)
         {
-            printf("\nFinished unrolling %d loops in %d passes", unrollCount, passes);
+            printf("\nFinished unrolling %d loops (%d partially) in %d passes", unrollCount + partialUnrollCount,
+                   partialUnrollCount, passes);
             printf("\n");
         }
 #endif // DEBUG
@@ -1708,6 +1721,162 @@ bool Compiler::optTryUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// optTryPartiallyUnrollLoop: Try to partially unroll a hot counted loop whose
+// trip count is not a compile time constant.
+//
+// Parameters:
+//   loop      - The loop to try unrolling
+//   changedIR - [out] Whether or not the IR was changed. Can be true even if
+//               the function returns false.
+//
+// Returns:
+//   True if the loop was unrolled, in which case the flow graph was changed.
+//
+// Remarks:
+//   The loop body is duplicated 2 or 4 times and the copies are chained
+//   together through the IV test, so every copy keeps its own exit test and
+//   no remainder loop is needed:
+//
+//     H: body; if (!cond) goto exit; -> H1: body; if (!cond) goto exit; -> ... -> H
+//
+//   This is not full partial unrolling: there is no unrolled body with a
+//   single test per group of iterations and a remainder loop. It only saves
+//   the backedge jumps and lets later phases optimize across consecutive
+//   iterations, so it is off unless JitPartialUnroll is set. Only innermost
+//   loops with a single backedge from the IV test are handled, and only when
+//   trusted profile data shows that the loop runs many iterations per method
+//   invocation.
+//
+bool Compiler::optTryPartiallyUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR)
+{
+    // Minimum number of iterations per method invocation for a loop to count as hot.
+    const weight_t MIN_ITERATIONS_PER_CALL = 16.0;
+
+    // Body size limits for unrolling by 4 and by 2.
+    const unsigned UNROLL_4_MAX_COST_SZ = 32;
+    const unsigned UNROLL_2_MAX_COST_SZ = 96;
+
+    if (JitConfig.JitPartialUnroll() == 0)
+    {
+        return false;
+    }
+
+    if ((compCodeOpt() == SMALL_CODE) || !fgHaveTrustedProfileWeights() || (loop->GetChild() != nullptr))
+    {
+        return false;
+    }
+
+    NaturalLoopIterInfo iterInfo;
+    if (!loop->AnalyzeIteration(&iterInfo) || (iterInfo.HasConstInit && iterInfo.HasConstLimit))
+    {
+        return false;
+    }
+
+    BasicBlock* const header    = loop->GetHeader();
+    BasicBlock* const testBlock = iterInfo.TestBlock;
+
+    if ((loop->BackEdges().size() != 1) || (loop->BackEdges()[0]->getSourceBlock() != testBlock))
+    {
+        return false;
+    }
+
+    assert(testBlock->KindIs(BBJ_COND));
+    assert(testBlock->TrueTargetIs(header) || testBlock->FalseTargetIs(header));
+
+    const weight_t entryWeight = fgFirstBB->bbWeight;
+    if (fgProfileWeightsEqual(entryWeight, 0.0) || ((header->bbWeight / entryWeight) < MIN_ITERATIONS_PER_CALL))
+    {
+        return false;
+    }
+
+    INDEBUG(const char* reason);
+    if (!loop->CanDuplicate(INDEBUG(&reason)))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": %s\n", loop->GetIndex(), reason);
+        return false;
+    }
+
+    // After this point, assume we've changed the IR. In particular, we call
+    // gtSetStmtInfo() which can modify the IR.
+    *changedIR = true;
+
+    ClrSafeInt<unsigned> loopCostSz;
+
+    loop->VisitLoopBlocksReversePostOrder([=, &loopCostSz](BasicBlock* block) {
+        for (Statement* const stmt : block->Statements())
+        {
+            gtSetStmtInfo(stmt);
+            loopCostSz += stmt->GetCostSz();
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    unsigned unrollFactor;
+    if (loopCostSz.IsOverflow() || (loopCostSz.Value() > UNROLL_2_MAX_COST_SZ))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": body too large (heuristic)\n", loop->GetIndex());
+        return false;
+    }
+    else if ((loopCostSz.Value() <= UNROLL_4_MAX_COST_SZ) && (compCodeOpt() == FAST_CODE))
+    {
+        unrollFactor = 4;
+    }
+    else
+    {
+        unrollFactor = 2;
+    }
+
+    JITDUMP("\nPartially unrolling loop " FMT_LP " by %u (body cost %u, " FMT_WT " iterations per call)\n",
+            loop->GetIndex(), unrollFactor, loopCostSz.Value(), header->bbWeight / entryWeight);
+    JITDUMPEXEC(FlowGraphNaturalLoop::Dump(loop));
+
+    // Each copy executes 1/unrollFactor of the iterations.
+    const weight_t scale = 1.0 / unrollFactor;
+    loop->VisitLoopBlocks([=](BasicBlock* block) {
+        block->scaleBBWeight(scale);
+        return BasicBlockVisit::Continue;
+    });
+
+    // Make all the copies first, while the original loop still has its
+    // original backedge, and then chain them together.
+    BlockToBlockMap blockMap(getAllocator(CMK_LoopUnroll));
+    BasicBlock*     insertAfter = loop->GetLexicallyBottomMostBlock();
+    BasicBlock*     copyHeaders[4];
+    BasicBlock*     copyTests[4];
+
+    copyHeaders[0] = header;
+    copyTests[0]   = testBlock;
+
+    for (unsigned i = 1; i < unrollFactor; i++)
+    {
+        loop->Duplicate(&insertAfter, &blockMap, /* weightScale */ 1.0);
+        copyHeaders[i] = blockMap[header];
+        copyTests[i]   = blockMap[testBlock];
+    }
+
+    for (unsigned i = 0; i < unrollFactor; i++)
+    {
+        BasicBlock* const test       = copyTests[i];
+        BasicBlock* const nextHeader = copyHeaders[(i + 1) % unrollFactor];
+
+        if (test->TrueTargetIs(copyHeaders[i]))
+        {
+            fgRedirectTrueEdge(test, nextHeader);
+        }
+        else
+        {
+            assert(test->FalseTargetIs(copyHeaders[i]));
+            fgRedirectFalseEdge(test, nextHeader);
+        }
+
+        JITDUMP("Chaining " FMT_BB " -> " FMT_BB "\n", test->bbNum, nextHeader->bbNum);
+    }
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // optRedirectPrevUnrollIteration:
 //   Redirect the previous unrolled loop iteration (or entry) to a new target.
@@ -5636,7 +5805,7 @@ void Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk, FlowGraphNatura
                             }
                         }
                     }
-                    else
+                    else if (!call->HasNoHeapWrites())
                     {
                         memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
                     }
@@ -2039,6 +2039,7 @@ void ReplaceVisitor::StartStatement(Statement* stmt)
     m_currentStmt       = stmt;
     m_madeChanges       = false;
     m_mayHaveForwardSub = false;
+    m_fieldTempArgs.Reset();
 
     InsertPreStatementWriteBacks();
     InsertPreStatementReadBacks();
@@ -2300,6 +2301,11 @@ void ReplaceVisitor::InsertPreStatementWriteBacks()
                     }
 
                     GenTreeLclVarCommon* lcl = node->AsLclVarCommon();
+                    if ((arg.GetNode() == lcl) && m_replacer->TryPassArgViaFieldTemp(call, lcl))
+                    {
+                        continue;
+                    }
+
                     m_replacer->WriteBackBeforeCurrentStatement(lcl->GetLclNum(), lcl->GetLclOffs(),
                                                                 lcl->GetLayout(m_compiler)->GetSize());
                 }
@@ -2546,6 +2552,18 @@ void ReplaceVisitor::ReplaceLocal(GenTree** use, GenTree* user)
                 offs + lcl->GetLayout(m_compiler)->GetSize());
 
         assert(effectiveUser->OperIs(GT_CALL, GT_RETURN, GT_SWIFT_ERROR_RET));
+
+        for (int i = 0; i < m_fieldTempArgs.Height(); i++)
+        {
+            const FieldTempArg& fieldTempArg = m_fieldTempArgs.BottomRef(i);
+            if (fieldTempArg.Use == lcl)
+            {
+                assert(effectiveUser == user);
+                PassArgViaFieldTemp(use, fieldTempArg.TempLclNum);
+                return;
+            }
+        }
+
         unsigned size = lcl->GetLayout(m_compiler)->GetSize();
         WriteBackBeforeUse(use, lclNum, lcl->GetLclOffs(), size);
 
@@ -2731,6 +2749,183 @@ void ReplaceVisitor::WriteBackBeforeUse(GenTree** use, unsigned lcl, unsigned of
     });
 }
 
+//------------------------------------------------------------------------
+// TryPassArgViaFieldTemp:
+//   Check whether a struct local passed as a call argument can instead be
+//   passed via a new independently promoted temp whose fields are copied
+//   from the replacements, and if so create that temp and insert the stores
+//   to its fields before the current statement.
+//
+// Parameters:
+//   call - The call
+//   lcl  - The struct local passed as an argument of the call
+//
+// Returns:
+//   True if the argument will be passed via a promoted temp; in that case no
+//   write backs are necessary before the call for this use.
+//
+// Remarks:
+//   Replacements overlapping a struct argument would otherwise have to be
+//   written back to the struct local's stack home before the call, only for
+//   morph to read them back when it splits the argument into the registers it
+//   is passed in. Morph passes independently promoted locals as a FIELD_LIST
+//   of their fields instead, so when those fields line up with both the
+//   replacements and the argument registers the values can stay in registers.
+//
+bool ReplaceVisitor::TryPassArgViaFieldTemp(GenTreeCall* call, GenTreeLclVarCommon* lcl)
+{
+#if defined(TARGET_ARM64) || defined(UNIX_AMD64_ABI)
+    AggregateInfo* agg = m_aggregates.Lookup(lcl->GetLclNum());
+    if ((agg == nullptr) || agg->CannotPassViaFieldTemp || !lcl->OperIs(GT_LCL_VAR))
+    {
+        return false;
+    }
+
+    CallArg* callArg = call->gtArgs.FindByNode(lcl);
+    if ((callArg == nullptr) || (callArg->GetWellKnownArg() != WellKnownArg::None))
+    {
+        return false;
+    }
+
+    // The fields of the temp are initialized before the statement, so nothing
+    // in the statement may run before the call and change the struct.
+    GenTree* root = m_currentStmt->GetRootNode();
+    if (((root != call) && !(root->OperIs(GT_STORE_LCL_VAR) && (root->AsLclVar()->Data() == call))) ||
+        (call->gtCallType == CT_INDIRECT))
+    {
+        return false;
+    }
+
+    for (CallArg& arg : call->gtArgs.Args())
+    {
+        if ((arg.GetNode() != lcl) && ((arg.GetNode()->gtFlags & (GTF_ASG | GTF_CALL)) != 0))
+        {
+            return false;
+        }
+    }
+
+    ClassLayout* layout = m_compiler->lvaGetDesc(lcl)->GetLayout();
+    if (layout->IsBlockLayout() || (layout->GetType() != TYP_STRUCT) || (layout->GetSize() <= TARGET_POINTER_SIZE) ||
+        (layout->GetSize() > MAX_PASS_MULTIREG_BYTES) || m_compiler->lvaHaveManyLocals())
+    {
+        return false;
+    }
+
+    // Check the fields the temp would be promoted into before creating it:
+    // every field must be in a replacement and be passed in its own register.
+    Compiler::StructPromotionHelper* helper = m_compiler->structPromotionHelper;
+    bool                             fieldsMatch = helper->CanPromoteStructType(layout->GetClassHandle());
+
+    if (fieldsMatch)
+    {
+        const Compiler::lvaStructPromotionInfo& info = helper->GetPromotionInfo();
+
+        bool isHfa = false;
+#ifdef TARGET_ARM64
+        isHfa = m_compiler->IsHfa(layout->GetClassHandle());
+#endif
+
+        fieldsMatch = isHfa || (info.fieldCnt <= 2);
+        for (unsigned i = 0; fieldsMatch && (i < info.fieldCnt); i++)
+        {
+            var_types fieldType = info.fields[i].fldType;
+
+            if (isHfa)
+            {
+                fieldsMatch = varTypeIsFloating(fieldType);
+            }
+            else
+            {
+                fieldsMatch = genTypeSize(fieldType) == TARGET_POINTER_SIZE;
+#ifdef TARGET_ARM64
+                // Non-HFA structs are passed in integer registers.
+                fieldsMatch &= varTypeUsesIntReg(fieldType);
+#endif
+            }
+
+            size_t index = Promotion::BinarySearch<Replacement, &Replacement::Offset>(agg->Replacements,
+                                                                                      info.fields[i].fldOffset);
+            fieldsMatch &= ((ssize_t)index >= 0) && (agg->Replacements[index].AccessType == fieldType);
+        }
+    }
+
+    if (!fieldsMatch)
+    {
+        JITDUMP("Cannot pass V%02u via a promoted temp: fields do not match replacements and registers\n",
+                agg->LclNum);
+        agg->CannotPassViaFieldTemp = true;
+        return false;
+    }
+
+    unsigned tempLclNum = m_compiler->lvaGrabTemp(false DEBUGARG("promoted struct arg temp"));
+    m_compiler->lvaSetStruct(tempLclNum, layout, /* unsafeValueClsCheck */ false);
+    m_compiler->lvaGetDesc(tempLclNum)->lvFieldAccessed = true;
+
+    if (!helper->TryPromoteStructVar(tempLclNum))
+    {
+        // Only promotion stress modes decline a promotable temp here.
+        JITDUMP("Cannot pass V%02u via a promoted temp: V%02u was not promoted\n", agg->LclNum, tempLclNum);
+        agg->CannotPassViaFieldTemp = true;
+        return false;
+    }
+
+    JITDUMP("Passing [%06u] V%02u via promoted temp V%02u\n", Compiler::dspTreeID(lcl), agg->LclNum, tempLclNum);
+
+    LclVarDsc* tempDsc = m_compiler->lvaGetDesc(tempLclNum);
+    for (unsigned i = 0; i < tempDsc->lvFieldCnt; i++)
+    {
+        unsigned   fieldLclNum = tempDsc->lvFieldLclStart + i;
+        LclVarDsc* fieldDsc    = m_compiler->lvaGetDesc(fieldLclNum);
+
+        size_t index = Promotion::BinarySearch<Replacement, &Replacement::Offset>(agg->Replacements,
+                                                                                  fieldDsc->lvFldOffset);
+        assert((ssize_t)index >= 0);
+        Replacement& rep = agg->Replacements[index];
+
+        // If the struct local is more up to date then read from it directly.
+        GenTree* value;
+        if (rep.NeedsReadBack)
+        {
+            value = m_compiler->gtNewLclFldNode(agg->LclNum, rep.AccessType, rep.Offset);
+            if (!m_compiler->lvaGetDesc(agg->LclNum)->lvDoNotEnregister)
+            {
+                m_compiler->lvaSetVarDoNotEnregister(agg->LclNum DEBUGARG(DoNotEnregisterReason::LocalField));
+            }
+        }
+        else
+        {
+            value = m_compiler->gtNewLclvNode(rep.LclNum, rep.AccessType);
+        }
+
+        Statement* stmt = m_compiler->fgNewStmtFromTree(m_compiler->gtNewStoreLclVarNode(fieldLclNum, value));
+        JITDUMP("Initializing V%02u from %s before " FMT_STMT "\n", fieldLclNum, rep.Description,
+                m_currentStmt->GetID());
+        DISPSTMT(stmt);
+        m_compiler->fgInsertStmtBefore(m_currentBlock, m_currentStmt, stmt);
+    }
+
+    m_fieldTempArgs.Push({lcl, tempLclNum});
+    return true;
+#else
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------
+// PassArgViaFieldTemp:
+//   Replace a struct argument with the promoted temp created for it by
+//   TryPassArgViaFieldTemp.
+//
+// Parameters:
+//   use        - The use of the struct local
+//   tempLclNum - The promoted temp
+//
+void ReplaceVisitor::PassArgViaFieldTemp(GenTree** use, unsigned tempLclNum)
+{
+    *use          = m_compiler->gtNewLclvNode(tempLclNum, m_compiler->lvaGetDesc(tempLclNum)->TypeGet());
+    m_madeChanges = true;
+}
+
 //------------------------------------------------------------------------
 // MarkForReadBack:
 //   Mark that replacements in the specified struct local need to be read
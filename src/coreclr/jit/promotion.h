@@ -100,6 +100,9 @@ struct AggregateInfo
     unsigned UnpromotedMin = 0;
     // Max offset in the struct local of the unpromoted part.
     unsigned UnpromotedMax = 0;
+    // Set once we have found that whole struct uses passed as call arguments
+    // cannot be passed via an independently promoted temp.
+    bool CannotPassViaFieldTemp = false;
 
     AggregateInfo(CompAllocator alloc, unsigned lclNum)
         : Replacements(alloc)
@@ -293,6 +296,14 @@ class ReplaceVisitor : public GenTreeVisitor<ReplaceVisitor>
 {
     friend class DecompositionPlan;
 
+    // A struct local passed as a call argument that will be passed via an
+    // independently promoted temp instead.
+    struct FieldTempArg
+    {
+        GenTreeLclVarCommon* Use;
+        unsigned             TempLclNum;
+    };
+
     Promotion*         m_promotion;
     AggregateInfoMap&  m_aggregates;
     PromotionLiveness* m_liveness;
@@ -302,6 +313,8 @@ class ReplaceVisitor : public GenTreeVisitor<ReplaceVisitor>
     Statement*         m_currentStmt         = nullptr;
     BasicBlock*        m_currentBlock        = nullptr;
 
+    ArrayStack<FieldTempArg> m_fieldTempArgs;
+
 public:
     enum
     {
@@ -315,6 +328,7 @@ public:
         , m_promotion(prom)
         , m_aggregates(aggregates)
         , m_liveness(liveness)
+        , m_fieldTempArgs(prom->m_compiler->getAllocator(CMK_Promotion))
     {
     }
 
@@ -353,6 +367,8 @@ private:
     void CheckForwardSubForLastUse(unsigned lclNum);
     void WriteBackBeforeCurrentStatement(unsigned lcl, unsigned offs, unsigned size);
     void WriteBackBeforeUse(GenTree** use, unsigned lcl, unsigned offs, unsigned size);
+    bool TryPassArgViaFieldTemp(GenTreeCall* call, GenTreeLclVarCommon* lcl);
+    void PassArgViaFieldTemp(GenTree** use, unsigned tempLclNum);
     void MarkForReadBack(GenTreeLclVarCommon* lcl, unsigned size DEBUGARG(const char* reason));
 
     void HandleStructStore(GenTree** use, GenTree* user);
@@ -228,7 +228,6 @@ class ScalarEvolutionContext
     void  ExtractAddOperands(ScevBinop* add, ArrayStack<Scev*>& operands);
 
     VNFunc                MapRelopToVNFunc(genTreeOps oper, bool isUnsigned);
-    RelopEvaluationResult EvaluateRelop(ValueNum relop);
     bool                  MayOverflowBeforeExit(ScevAddRec* lhs, Scev* rhs, VNFunc exitOp);
 
     bool Materialize(Scev* scev, bool createIR, GenTree** result, ValueNum* resultVN);
@@ -250,4 +249,6 @@ public:
 
     GenTree* Materialize(Scev* scev);
     ValueNum MaterializeVN(Scev* scev);
+
+    RelopEvaluationResult EvaluateRelop(ValueNum relop);
 };
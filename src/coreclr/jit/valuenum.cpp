@@ -13014,19 +13014,29 @@ void Compiler::fgValueNumberCall(GenTreeCall* call)
     }
     else
     {
+        // Calls whose callee was scanned and found to not write to the heap
+        // are not memory defs; see fgPerNodeLocalVarLiveness.
+        const bool modHeap = !call->HasNoHeapWrites();
+
         if (call->TypeIs(TYP_VOID))
         {
             call->gtVNPair.SetBoth(ValueNumStore::VNForVoid());
 
-            // For now, arbitrary side effect on GcHeap/ByrefExposed.
-            fgMutateGcHeap(call DEBUGARG("CALL"));
+            if (modHeap)
+            {
+                // For now, arbitrary side effect on GcHeap/ByrefExposed.
+                fgMutateGcHeap(call DEBUGARG("CALL"));
+            }
         }
         else if (!call->IsSpecialIntrinsic() || !fgValueNumberSpecialIntrinsic(call))
         {
             call->gtVNPair.SetBoth(vnStore->VNForExpr(compCurBB, call->TypeGet()));
 
-            // For now, arbitrary side effect on GcHeap/ByrefExposed.
-            fgMutateGcHeap(call DEBUGARG("CALL"));
+            if (modHeap)
+            {
+                // For now, arbitrary side effect on GcHeap/ByrefExposed.
+                fgMutateGcHeap(call DEBUGARG("CALL"));
+            }
         }
     }
 
@@ -2312,6 +2312,22 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
             readOnlyFlags = MAP_FILE|MAP_SHARED|MAP_FIXED;
     }
 
+#ifdef MADV_HUGEPAGE
+    // If PAL_MAP_PE_TEXT_AS_HUGE_PAGE is set to 1, advise the kernel to back the executable sections
+    // with transparent huge pages. This reduces iTLB pressure for large ReadyToRun images; it only has an
+    // effect when the kernel supports huge pages for read-only file mappings.
+    bool adviseTextHugePage;
+    adviseTextHugePage = false;
+    {
+        char *textHugePage = EnvironGetenv("PAL_MAP_PE_TEXT_AS_HUGE_PAGE");
+        if (textHugePage != NULL)
+        {
+            adviseTextHugePage = (strcmp(textHugePage, "1") == 0);
+            free(textHugePage);
+        }
+    }
+#endif // MADV_HUGEPAGE
+
     //we have now reserved memory (potentially we got rebased).  Walk the PE sections and map each part
     //separately.
 
@@ -2441,6 +2457,14 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
             goto doneReleaseMappingCriticalSection;
         }
 
+#ifdef MADV_HUGEPAGE
+        if (adviseTextHugePage && ((prot & (PROT_EXEC | PROT_WRITE)) == PROT_EXEC))
+        {
+            // This is only a hint; failure leaves the section mapped with regular pages.
+            madvise(sectionBaseAligned, (char*)sectionBase + currentHeader.SizeOfRawData - (char*)sectionBaseAligned, MADV_HUGEPAGE);
+        }
+#endif // MADV_HUGEPAGE
+
 #if _DEBUG
         {
             // Ensure null termination of section name (which is allowed to not be null terminated if exactly 8 characters long)
@@ -53,6 +53,10 @@ CRITICAL_SECTION virtual_critsec;
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The most recently found or inserted node. Lookups and inserts for addresses
+// at or above it start walking from here instead of from the head of the list.
+static PCMI pVirtualMemoryLastEntry;
+
 static size_t s_virtualPageSize = 0;
 
 /* We need MAP_ANON. However on some platforms like HP-UX, it is defined as MAP_ANONYMOUS */
@@ -173,6 +177,7 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
     InternalInitializeCriticalSection(&virtual_critsec);
 
     pVirtualMemory = NULL;
+    pVirtualMemoryLastEntry = NULL;
 
     if (initializeExecutableMemoryAllocator)
     {
@@ -208,6 +213,7 @@ void VIRTUALCleanup()
         free(pTempEntry );
     }
     pVirtualMemory = NULL;
+    pVirtualMemoryLastEntry = NULL;
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
 
@@ -250,6 +256,11 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
     pEntry = pVirtualMemory;
+    if ( pVirtualMemoryLastEntry && pVirtualMemoryLastEntry->startBoundary <= address )
+    {
+        /* The list is sorted, so the region can't be before the last entry. */
+        pEntry = pVirtualMemoryLastEntry;
+    }
 
     while( pEntry )
     {
@@ -261,6 +272,7 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
         }
         if ( pEntry->startBoundary + pEntry->memSize > address )
         {
+            pVirtualMemoryLastEntry = pEntry;
             break;
         }
 
@@ -288,6 +300,11 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    if ( pMemoryToBeReleased == pVirtualMemoryLastEntry )
+    {
+        pVirtualMemoryLastEntry = pMemoryToBeReleased->pPrevious;
+    }
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -413,6 +430,10 @@ static BOOL VIRTUALStoreAllocationInfo(
     pNewEntry->accessProtection = flProtection;
 
     pMemInfo = pVirtualMemory;
+    if (pVirtualMemoryLastEntry && pVirtualMemoryLastEntry->startBoundary < startBoundary)
+    {
+        pMemInfo = pVirtualMemoryLastEntry;
+    }
 
     if (pMemInfo && pMemInfo->startBoundary < startBoundary)
     {
@@ -447,6 +468,8 @@ static BOOL VIRTUALStoreAllocationInfo(
         pVirtualMemory = pNewEntry ;
     }
 
+    pVirtualMemoryLastEntry = pNewEntry;
+
 #ifdef DEBUG
     VerifyRightEntry(pNewEntry);
     VerifyLeftEntry(pNewEntry);
@@ -65,6 +65,19 @@ CorJitResult interceptor_ICJC::compileMethod(ICorJitInfo*                comp,
         }
     }
 
+    // See if we are only collecting methods that were called often enough to be rejitted at tier1,
+    // which keeps collections from long-running processes down to their hot methods.
+    //
+    if (g_collectTier1Only)
+    {
+        CORJIT_FLAGS jitFlags;
+        comp->getJitFlags(&jitFlags, sizeof(jitFlags));
+        if (!jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1))
+        {
+            return original_ICorJitCompiler->compileMethod(comp, info, flags, nativeEntry, nativeSizeOfCode);
+        }
+    }
+
     auto* mc = new MethodContext();
     interceptor_ICJI our_ICorJitInfo(this, comp, mc);
 
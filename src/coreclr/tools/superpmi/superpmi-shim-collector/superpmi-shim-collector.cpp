@@ -27,6 +27,7 @@ WCHAR*         g_DefaultRealJitPath = nullptr;
 MethodContext* g_globalContext      = nullptr;
 bool           g_initialized        = false;
 char*          g_collectionFilter   = nullptr;
+bool           g_collectTier1Only   = false;
 
 void SetDefaultPaths()
 {
@@ -89,6 +90,18 @@ void SetCollectionFilter()
     {
         fprintf(stderr, "*** SPMI filter '%s'\n", g_collectionFilter);
     }
+
+    char* tier1Only = GetEnvironmentVariableWithDefaultA("SuperPMIShimTier1Only", nullptr);
+    if (tier1Only != nullptr)
+    {
+        g_collectTier1Only = (strcmp(tier1Only, "1") == 0);
+        delete[] tier1Only;
+    }
+
+    if (g_collectTier1Only)
+    {
+        fprintf(stderr, "*** SPMI collecting tier1 methods only\n");
+    }
 }
 
 void InitializeShim()
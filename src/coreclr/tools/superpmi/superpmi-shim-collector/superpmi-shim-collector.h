@@ -10,6 +10,7 @@
 class MethodContext;
 extern MethodContext* g_globalContext;
 extern char*          g_collectionFilter;
+extern bool           g_collectTier1Only;
 
 void DebugBreakorAV(int val);
 
@@ -2605,6 +2605,10 @@ MethodSectionIterator::MethodSectionIterator(const void *code, SIZE_T codeSize,
     {
         m_dword = *m_codeTable++;
         m_index = 0;
+
+        // DWORDs inside a code block point at its start and hold no method starts
+        if (IS_NIBBLE_MAP_POINTER(m_dword))
+            m_dword = 0;
     }
     else
     {
@@ -2636,6 +2640,9 @@ BOOL MethodSectionIterator::Next()
         {
             m_dword = *m_codeTable++;
             m_index = 0;
+
+            if (IS_NIBBLE_MAP_POINTER(m_dword))
+                m_dword = 0;
         }
     }
     return FALSE;
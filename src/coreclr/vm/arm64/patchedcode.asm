@@ -56,6 +56,8 @@ wbs_lowest_address
         DCQ 0
 wbs_highest_address
         DCQ 0
+wbs_region_to_generation_table
+        DCQ 0
 #ifdef WRITE_BARRIER_CHECK
 wbs_GCShadow
         DCQ 0
@@ -74,7 +76,8 @@ wbs_GCShadowEnd
 ;   x13  : incremented by 8
 ;   x14  : incremented by 8
 ;   x15  : trashed
-;   x17  : trashed (ip1) if FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+;   x16  : trashed (ip0)
+;   x17  : trashed (ip1)
 ;
 ;   NOTE: Keep in sync with RBM_CALLEE_TRASH_WRITEBARRIER_BYREF and RBM_CALLEE_GCTRASH_WRITEBARRIER_BYREF
 ;         if you add more trashed registers.
@@ -97,7 +100,8 @@ wbs_GCShadowEnd
 ;   x12  : trashed
 ;   x14  : incremented by 8
 ;   x15  : trashed
-;   x17  : trashed (ip1) if FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+;   x16  : trashed (ip0)
+;   x17  : trashed (ip1)
 ;
     WRITE_BARRIER_ENTRY JIT_CheckedWriteBarrier
         ldr      x12,  wbs_lowest_address
@@ -121,7 +125,8 @@ NotInHeap
 ;   x12  : trashed
 ;   x14  : incremented by 8
 ;   x15  : trashed
-;   x17  : trashed (ip1) if FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+;   x16  : trashed (ip0)
+;   x17  : trashed (ip1)
 ;
     WRITE_BARRIER_ENTRY JIT_WriteBarrier
         stlr     x15, [x14]
@@ -198,6 +203,55 @@ CheckCardTable
         bhs      Exit
 
 SkipEphemeralCheck
+        ; With regions, only old-to-young stores need a card. wbs_region_to_generation_table
+        ; holds the (skewed) table in its low 56 bits, the region shift in bits 56-61 and
+        ; whether to mark cards bit by bit in bit 63.
+        ldr      x12, wbs_region_to_generation_table
+        cbz      x12, CheckCardByte
+
+        ; The table only covers [g_lowest_address, g_highest_address). The object may be null or
+        ; live outside the GC heap (e.g. a frozen object), so use the card path for it instead.
+        ldr      x16, wbs_lowest_address
+        cmp      x15, x16
+        ldr      x16, wbs_highest_address
+        ccmp     x15, x16, #0x2, hs
+        bhs      CheckCardByte
+
+        ubfx     x17, x12, #56, #6
+        and      x16, x12, #0x00FFFFFFFFFFFFFF
+        lsr      x15, x15, x17
+        lsr      x17, x14, x17
+
+        ; Nothing to do if the region we're storing into is gen0
+        ldrb     w17, [x16, x17]
+        cbz      x17, Exit
+
+        ; or if the object isn't younger than the region we're storing into
+        ldrb     w15, [x16, x15]
+        cmp      x15, x17
+        bhs      Exit
+
+        tbz      x12, #63, CheckCardByte
+
+        ; Bit precise card: bit (x14 >> 8) & 7 of card byte x14 >> 11
+        ldr      x12, wbs_card_table
+        add      x15, x12, x14, lsr #11
+        ubfx     x12, x14, #8, #3
+        mov      x17, #1
+        lsl      x17, x17, x12
+        ldrb     w12, [x15]
+        tst      x12, x17
+        bne      Exit
+
+UpdateCardBit
+        ; Other bits in this byte can be set concurrently so this has to be atomic
+        ldxrb    w12, [x15]
+        orr      w12, w12, w17
+        stxrb    w16, w12, [x15]
+        cbnz     w16, UpdateCardBit
+        b        CheckCardBundle
+
+CheckCardByte
         ; Check if we need to update the card table
         ldr      x12, wbs_card_table
 
@@ -212,6 +266,7 @@ UpdateCardTable
         mov      x12, 0xFF
         strb     w12, [x15]
 
+CheckCardBundle
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
         ; Check if we need to update the card bundle table
         ldr      x12, wbs_card_bundle_table
@@ -95,10 +95,73 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    // creating the table may have triggered a GC, read the current table only now.
+    DWORD* tableData = TableData(*s_pTableRef);
+    if (TableMask(tableData) != 1)
+    {
+        // carry over what is in the current table so that growing does not cost every cached cast a miss.
+        // the 2-element sentinel never has entries.
+        CopyEntries(tableData, TableData(newTable));
+    }
+
     SetObjectReference((OBJECTREF *)s_pTableRef, newTable);
     return TRUE;
 }
 
+void CastCache::CopyEntries(DWORD* tableData, DWORD* newTableData)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD count = CacheElementCount(tableData);
+    for (DWORD i = 0; i < count; i++)
+    {
+        CastCacheEntry* pEntry = &Elements(tableData)[i];
+
+        // same protocol as in TryGet: version -> [entry parts] -> version
+        // the current table is still live, skip entries that are unclaimed, changing or have changed.
+        DWORD version = VolatileLoad(&pEntry->version);
+        if (version == 0 || (version & 1))
+        {
+            continue;
+        }
+
+        TADDR source = pEntry->Source();
+        TADDR target = pEntry->Target();
+        BOOL result = pEntry->Result();
+
+        VolatileLoadBarrier();
+        if (version != pEntry->version)
+        {
+            continue;
+        }
+
+        // the new table is not published yet, so nothing else can write to it.
+        // no need to claim entries, just take the first free one in the bucket, if any.
+        DWORD index = KeyToBucket(newTableData, source, target);
+        for (DWORD j = 0; j < BUCKET_SIZE;)
+        {
+            CastCacheEntry* pNewEntry = &Elements(newTableData)[index];
+            if (pNewEntry->version == 0)
+            {
+                pNewEntry->SetEntry(source, target, result);
+                // distance from the bucket origin + an even, nonzero version number.
+                pNewEntry->version = (j << VERSION_NUM_SIZE) + 2;
+                break;
+            }
+
+            // quadratic reprobe
+            j++;
+            index = (index + j) & TableMask(newTableData);
+        }
+    }
+}
+
 void CastCache::FlushCurrentCache()
 {
     CONTRACTL
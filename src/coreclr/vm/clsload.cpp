@@ -2789,14 +2789,17 @@ TypeHandle ClassLoader::PublishType(const TypeKey *pTypeKey, TypeHandle typeHnd)
         Module *pLoaderModule = ComputeLoaderModule(pTypeKey);
         EETypeHashTable *pTable = pLoaderModule->GetAvailableParamTypes();
 
+        // Hash outside of the lock, it is shared by all the types published into this loader module
+        DWORD dwHash = HashTypeKey(pTypeKey);
+
         CrstHolder ch(&pLoaderModule->GetClassLoader()->m_AvailableTypesLock);
 
         // The type could have been loaded by a different thread as side-effect of avoiding deadlocks caused by LoadsTypeViolation
-        TypeHandle existing = pTable->GetValue(pTypeKey);
+        TypeHandle existing = pTable->GetValue(pTypeKey, dwHash);
         if (!existing.IsNull())
             return existing;
 
-        pTable->InsertValue(typeHnd);
+        pTable->InsertValue(typeHnd, dwHash);
     }
     else
     {
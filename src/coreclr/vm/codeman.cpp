@@ -3153,7 +3153,8 @@ JumpStubBlockHeader *  EEJitManager::allocJumpStubBlock(MethodDesc* pMD, DWORD n
     requestInfo.setThrowOnOutOfMemoryWithinRange(throwOnOutOfMemoryWithinRange);
 
     TADDR                  mem;
-    ExecutableWriterHolderNoLog<JumpStubBlockHeader> blockWriterHolder;
+    ExecutableWriterHolderNoLog<BYTE> blockWriterHolder;
+    JumpStubBlockHeader *  pBlockRW;
 
     // Scope the lock
     {
@@ -3166,25 +3167,26 @@ JumpStubBlockHeader *  EEJitManager::allocJumpStubBlock(MethodDesc* pMD, DWORD n
             RETURN(NULL);
         }
 
-        // CodeHeader comes immediately before the block
+        // CodeHeader comes immediately before the block. Write both through a single RW mapping
+        // so that W^X does not have to map this memory twice.
         CodeHeader * pCodeHdr = (CodeHeader *) (mem - sizeof(CodeHeader));
-        ExecutableWriterHolder<CodeHeader> codeHdrWriterHolder(pCodeHdr, sizeof(CodeHeader));
-        codeHdrWriterHolder.GetRW()->SetStubCodeBlockKind(STUB_CODE_BLOCK_JUMPSTUB);
+        blockWriterHolder.AssignExecutableWriterHolder((BYTE *)pCodeHdr, sizeof(CodeHeader) + sizeof(JumpStubBlockHeader));
+        ((CodeHeader *)blockWriterHolder.GetRW())->SetStubCodeBlockKind(STUB_CODE_BLOCK_JUMPSTUB);
 
-        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE);
+        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE, blockSize);
 
-        blockWriterHolder.AssignExecutableWriterHolder((JumpStubBlockHeader *)mem, sizeof(JumpStubBlockHeader));
+        pBlockRW = (JumpStubBlockHeader *)(blockWriterHolder.GetRW() + sizeof(CodeHeader));
 
-        _ASSERTE(IS_ALIGNED(blockWriterHolder.GetRW(), CODE_SIZE_ALIGN));
+        _ASSERTE(IS_ALIGNED(pBlockRW, CODE_SIZE_ALIGN));
     }
 
-    blockWriterHolder.GetRW()->m_next            = NULL;
-    blockWriterHolder.GetRW()->m_used            = 0;
-    blockWriterHolder.GetRW()->m_allocated       = numJumps;
+    pBlockRW->m_next            = NULL;
+    pBlockRW->m_used            = 0;
+    pBlockRW->m_allocated       = numJumps;
     if (pMD && pMD->IsLCGMethod())
-        blockWriterHolder.GetRW()->SetHostCodeHeap(static_cast<HostCodeHeap*>(pCodeHeap->pHeap));
+        pBlockRW->SetHostCodeHeap(static_cast<HostCodeHeap*>(pCodeHeap->pHeap));
     else
-        blockWriterHolder.GetRW()->SetLoaderAllocator(pLoaderAllocator);
+        pBlockRW->SetLoaderAllocator(pLoaderAllocator);
 
     LOG((LF_JIT, LL_INFO1000, "Allocated new JumpStubBlockHeader for %d stubs at" FMT_ADDR " in loader allocator " FMT_ADDR "\n",
          numJumps, DBG_ADDR(mem) , DBG_ADDR(pLoaderAllocator) ));
@@ -3223,7 +3225,7 @@ void * EEJitManager::allocCodeFragmentBlock(size_t blockSize, unsigned alignment
         ExecutableWriterHolder<CodeHeader> codeHdrWriterHolder(pCodeHdr, sizeof(CodeHeader));
         codeHdrWriterHolder.GetRW()->SetStubCodeBlockKind(kind);
 
-        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE);
+        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE, blockSize);
 
         // Record the jump stub reservation
         pCodeHeap->reserveForJumpStubs += requestInfo.getReserveForJumpStubs();
@@ -3980,7 +3982,15 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
     // get DWORD and shift down our nibble
 
     PREFIX_ASSUME(pMap != NULL);
-    tmp = VolatileLoadWithoutBarrier<DWORD>(pMap) >> POS2SHIFTCOUNT(startPos);
+    tmp = VolatileLoadWithoutBarrier<DWORD>(pMap);
+
+    // The DWORD lies entirely inside a code block and points at its start
+    if (IS_NIBBLE_MAP_POINTER(tmp))
+    {
+        return base + NIBBLE_MAP_POINTER2ADDR(tmp);
+    }
+
+    tmp = tmp >> POS2SHIFTCOUNT(startPos);
 
     if ((tmp & NIBBLE_MASK) && ((tmp & NIBBLE_MASK) <= offset) )
     {
@@ -4017,6 +4027,11 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
         startPos -= NIBBLES_PER_DWORD;
     }
 
+    if (IS_NIBBLE_MAP_POINTER(tmp))
+    {
+        return base + NIBBLE_MAP_POINTER2ADDR(tmp);
+    }
+
     // This helps to catch degenerate error cases. This relies on the fact that
     // startPos cannot ever be bigger than MAX_UINT
     if (((INT_PTR)startPos) < 0)
@@ -4038,7 +4053,7 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
 
 #if !defined(DACCESS_COMPILE)
 
-void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
+void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize)
 {
     CONTRACTL {
         NOTHROW;
@@ -4046,10 +4061,13 @@ void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
     } CONTRACTL_END;
 
     CrstHolder ch(&m_CodeHeapCritSec);
-    NibbleMapSetUnlocked(pHp, pCode, bSet);
+    NibbleMapSetUnlocked(pHp, pCode, bSet, codeSize);
 }
 
-void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet)
+// When setting, codeSize is the size of the code block starting at pCode; every map DWORD that
+// lies entirely inside the block is made to point at pCode. When clearing, those pointers are
+// found by walking forward from the header, so codeSize is not needed.
+void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize)
 {
     CONTRACTL {
         NOTHROW;
@@ -4080,6 +4098,32 @@ void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet)
 
     // It is important for this update to be atomic. Synchronization would be required with FindMethodCode otherwise.
     *(pMap+index) = ((*(pMap+index))&mask)|value;
+
+    if (delta >= MAX_NIBBLE_MAP_POINTER)
+    {
+        // The start cannot be encoded in a pointer; lookups fall back to scanning backward.
+        return;
+    }
+
+    DWORD pointer = ADDR2NIBBLE_MAP_POINTER(delta);
+
+    if (bSet)
+    {
+        size_t endIndex = (delta + codeSize) / BYTES_PER_MAP_DWORD;
+        for (size_t i = (size_t)index + 1; i < endIndex; i++)
+        {
+            _ASSERTE(*(pMap+i) == 0);
+            *(pMap+i) = pointer;
+        }
+    }
+    else
+    {
+        size_t mapCount = HEAP2MAPSIZE(ROUND_UP_TO_PAGE(pHp->maxCodeHeapSize)) / sizeof(DWORD);
+        for (size_t i = (size_t)index + 1; (i < mapCount) && (*(pMap+i) == pointer); i++)
+        {
+            *(pMap+i) = 0;
+        }
+    }
 }
 #endif // !DACCESS_COMPILE
 
@@ -4105,17 +4149,35 @@ PTR_RUNTIME_FUNCTION EEJitManager::LazyGetFunctionEntry(EECodeInfo * pCodeInfo)
     // Thus, save it off right now.
     TADDR baseAddress = pCodeInfo->GetModuleBase();
 
-    // NOTE: We could binary search here, if it would be helpful (e.g., large number of funclets)
-    for (UINT iUnwindInfo = 0; iUnwindInfo < pHeader->GetNumberOfUnwindInfos(); iUnwindInfo++)
+    // The unwind infos are emitted in code address order (CEEJitInfo::allocUnwindInfo asserts this),
+    // so binary search for the last one that starts at or before the address. Methods with many
+    // funclets are common on the exception and GC stack walk paths.
+    UINT low = 0;
+    UINT high = pHeader->GetNumberOfUnwindInfos();
+    while (low < high)
     {
-        PTR_RUNTIME_FUNCTION pFunctionEntry = pHeader->GetUnwindInfo(iUnwindInfo);
-
-        if (RUNTIME_FUNCTION__BeginAddress(pFunctionEntry) <= address && address < RUNTIME_FUNCTION__EndAddress(pFunctionEntry, baseAddress))
+        UINT mid = low + (high - low) / 2;
+        if (RUNTIME_FUNCTION__BeginAddress(pHeader->GetUnwindInfo(mid)) <= address)
+        {
+            low = mid + 1;
+        }
+        else
         {
-            return pFunctionEntry;
+            high = mid;
         }
     }
 
+    if (low == 0)
+    {
+        return NULL;
+    }
+
+    PTR_RUNTIME_FUNCTION pFunctionEntry = pHeader->GetUnwindInfo(low - 1);
+    if (address < RUNTIME_FUNCTION__EndAddress(pFunctionEntry, baseAddress))
+    {
+        return pFunctionEntry;
+    }
+
     return NULL;
 }
 
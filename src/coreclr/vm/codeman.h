@@ -1820,8 +1820,8 @@ public:
 
 #ifndef DACCESS_COMPILE
 	// Heap Management functions
-    void NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet);
-    void NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet);
+    void NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize = 0);
+    void NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize = 0);
 #endif  // !DACCESS_COMPILE
 
     static TADDR FindMethodCode(RangeSection * pRangeSection, PCODE currentPC);
@@ -4840,6 +4840,37 @@ namespace
         bool                             m_bILStubCreator;     // Only the creator can remove the ILStub from the Cache
     };  //ILStubCreatorHelper
 
+    // Returns true if the return type and every parameter in the signature is a primitive type (including
+    // void and string), so the signature does not reference any type owned by the module it was declared in.
+    bool HasOnlyPrimitiveTypes(const Signature& sig)
+    {
+        STANDARD_VM_CONTRACT;
+
+        SigPointer sigPtr = sig.CreateSigPointer();
+
+        uint32_t callConvInfo;
+        IfFailThrow(sigPtr.GetCallingConvInfo(&callConvInfo));
+        if (callConvInfo & IMAGE_CEE_CS_CALLCONV_GENERIC)
+            return false;
+
+        uint32_t numArgs;
+        IfFailThrow(sigPtr.GetData(&numArgs));
+
+        // Return type followed by the parameters. Custom modifiers, pointers and
+        // sentinels are rejected along with any non-primitive type.
+        for (uint32_t i = 0; i <= numArgs; i++)
+        {
+            CorElementType type;
+            IfFailThrow(sigPtr.PeekElemType(&type));
+            if (!CorIsPrimitiveType(type))
+                return false;
+
+            IfFailThrow(sigPtr.SkipExactlyOne());
+        }
+
+        return true;
+    }
+
     MethodDesc* CreateInteropILStub(
                             ILStubState*             pss,
                             StubSigDesc*             pSigDesc,
@@ -4898,6 +4929,20 @@ namespace
         }
 #endif // FEATURE_COMINTEROP
 
+        // Shared stubs for signatures made up only of primitive types and strings don't depend on anything owned
+        // by a collectible loader allocator. Cache them with CoreLib instead so that they survive the
+        // unload of the AssemblyLoadContext and are not regenerated every time it is reloaded.
+        // The stub's resolver records the target MethodDesc, so this is only done when that target
+        // will outlive the stub as well.
+        if (SF_IsSharedStub(dwStubFlags)
+            && pTargetMT == NULL
+            && pLoaderModule->IsCollectible()
+            && (pTargetMD == NULL || !pTargetMD->GetLoaderAllocator()->IsCollectible())
+            && HasOnlyPrimitiveTypes(pSigDesc->m_sig))
+        {
+            pLoaderModule = SystemDomain::SystemModule();
+        }
+
         // Otherwise, fall back to generating IL stub on-the-fly
         NDirectStubParameters    params(pSigDesc->m_sig,
                                 &pSigDesc->m_typeContext,
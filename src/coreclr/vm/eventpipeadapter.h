@@ -192,6 +192,12 @@ public:
 		return ep_enabled();
 	}
 
+	static inline bool SetLosslessWritesForCurrentThread(bool lossless)
+	{
+		STATIC_CONTRACT_NOTHROW;
+		return ep_set_lossless_writes_for_current_thread(lossless);
+	}
+
 	static inline EventPipeSessionID Enable(
 		LPCWSTR outputPath,
 		uint32_t circularBufferSizeInMB,
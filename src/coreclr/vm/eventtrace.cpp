@@ -768,6 +768,7 @@ BOOL ETW::TypeSystemLog::s_fHeapAllocEventEnabledOnStartup = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocHighEventEnabledNow = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocLowEventEnabledNow = FALSE;
 int ETW::TypeSystemLog::s_nCustomMsBetweenEvents = 0;
+DWORD ETW::TypeSystemLog::s_cbAllocationSamplingInterval = 0;
 
 
 //---------------------------------------------------------------------------------------
@@ -822,6 +823,10 @@ void ETW::TypeSystemLog::PostRegistrationInit()
     // keeps things consistent.
     s_fHeapAllocEventEnabledOnStartup = (s_fHeapAllocLowEventEnabledNow || s_fHeapAllocHighEventEnabledNow);
 
+    // Allocation sampling is cheap enough to be on for the life of the process; the
+    // histogram it builds is only sent when a session asks for it.
+    s_cbAllocationSamplingInterval = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_AllocationSamplingInterval);
+
     if (s_fHeapAllocEventEnabledOnStartup)
     {
         // Determine if a COMPLUS env var is overriding the frequency for the sampled
@@ -883,6 +888,14 @@ void ETW::TypeSystemLog::OnKeywordsChanged()
     // because it is extremely smart.
     if (!ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_TYPE_KEYWORD))
         OnTypesKeywordTurnedOff();
+
+    // Enabling the allocation sampling keyword is how a session asks for the current
+    // allocation sample histogram.
+    if (IsAllocationSamplingEnabled() &&
+        ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_ALLOCATIONSAMPLING_KEYWORD))
+    {
+        SendAllocationSampleHistogram();
+    }
 }
 
 
@@ -1137,6 +1150,247 @@ void ETW::TypeSystemLog::SendObjectAllocatedEvent(Object * pObject)
     }
 }
 
+// One entry of the allocation sample histogram. Entries are keyed on the type and a hash
+// of the allocating call stack.
+struct AllocationSampleEntry
+{
+    TypeHandle th;
+    UINT32 stackHash;
+    UINT32 sampleCount;
+    UINT64 objectBytes;
+};
+
+// Open addressed and never shrinks - once it's full, samples for new type / stack
+// combinations are counted in s_cAllocationSamplesDropped instead. Protected by
+// s_lAllocationSamplesLock, which allocating threads only ever try to take so a sample
+// never blocks an allocation.
+static const int k_nAllocationSampleEntries = 4096;
+static AllocationSampleEntry s_rgAllocationSamples[k_nAllocationSampleEntries];
+static UINT32 s_cAllocationSamplesDropped = 0;
+static LONG s_lAllocationSamplesLock = 0;
+
+// The number of managed frames that go into the stack hash of a sample
+static const int k_nAllocationSampleStackFrames = 8;
+
+struct AllocationSampleStackWalkData
+{
+    UINT32 stackHash;
+    int cFrames;
+};
+
+static StackWalkAction AllocationSampleStackWalkCallback(CrawlFrame * pCF, VOID * pData)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    AllocationSampleStackWalkData * pStackWalkData = (AllocationSampleStackWalkData *) pData;
+    MethodDesc * pMD = pCF->GetFunction();
+    if (pMD != NULL)
+    {
+        // FNV-1a over the MethodDesc pointers - these stay the same across tiers so the
+        // same call site always hashes the same
+        UINT64 value = (UINT64)(SIZE_T)pMD;
+        pStackWalkData->stackHash = (pStackWalkData->stackHash ^ (UINT32)value) * 16777619;
+        pStackWalkData->stackHash = (pStackWalkData->stackHash ^ (UINT32)(value >> 32)) * 16777619;
+        pStackWalkData->cFrames++;
+    }
+
+    return (pStackWalkData->cFrames < k_nAllocationSampleStackFrames) ? SWA_CONTINUE : SWA_ABORT;
+}
+
+// Returns the number of bytes to allocate before the next sample. The distance is
+// exponentially distributed so samples form a Poisson process over allocated bytes.
+static INT64 GetNextAllocationSampleDistance(UINT64 * pRandomState, DWORD cbMeanDistance)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // xorshift64*
+    UINT64 x = *pRandomState;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *pRandomState = x;
+    UINT64 random = x * 0x2545F4914F6CDD1DULL;
+
+    // Uniform in (0, 1]
+    double u = ((double)(random >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+    return (INT64)(-log(u) * cbMeanDistance) + 1;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Records an allocation sample for the object if the allocating thread got past its
+// sampling point. We only check on the slow allocation path, which every allocation
+// context refill goes through, and the refill is what moves the thread's allocated byte
+// count forward. So in steady state this costs a compare per refill and the sampled
+// object is the one that needed the refill.
+//
+// The call stack is walked for every sample, which a thread takes about once per
+// sampling interval of allocated bytes. If another thread holds the histogram, the
+// sample is counted as dropped rather than waiting.
+//
+// Arguments:
+//      * pObject - Allocated object
+//
+
+// static
+void ETW::TypeSystemLog::SampleObjectAllocationIfNecessary(Object * pObject)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (!g_fEEStarted || !GCHeapUtilities::UseThreadAllocationContexts())
+        return;
+
+    RuntimeThreadLocals * pThreadLocals = &t_runtime_thread_locals;
+    INT64 cbAllocated = pThreadLocals->alloc_context.alloc_bytes + pThreadLocals->alloc_context.alloc_bytes_uoh;
+    if (cbAllocated < pThreadLocals->alloc_sampling_threshold)
+        return;
+
+    if (pThreadLocals->alloc_sampling_threshold == 0)
+    {
+        // First time on this thread - pick where the first sample goes.
+        pThreadLocals->alloc_sampling_random_state = (((UINT64)(SIZE_T)pThreadLocals * 0x9E3779B97F4A7C15ULL) ^ CLRGetTickCount64()) | 1;
+        pThreadLocals->alloc_sampling_threshold = cbAllocated + GetNextAllocationSampleDistance(&pThreadLocals->alloc_sampling_random_state, s_cbAllocationSamplingInterval);
+        return;
+    }
+
+    // A single large allocation can cover more than one sampling point.
+    UINT32 cSamples = 0;
+    do
+    {
+        cSamples++;
+        pThreadLocals->alloc_sampling_threshold += GetNextAllocationSampleDistance(&pThreadLocals->alloc_sampling_random_state, s_cbAllocationSamplingInterval);
+    }
+    while ((pThreadLocals->alloc_sampling_threshold <= cbAllocated) && (cSamples < UINT16_MAX));
+
+    if (pThreadLocals->alloc_sampling_threshold <= cbAllocated)
+    {
+        pThreadLocals->alloc_sampling_threshold = cbAllocated + 1;
+    }
+
+    TypeHandle th = pObject->GetTypeHandle();
+
+    // Types in collectible assemblies could be gone by the time we send the histogram.
+    if (th.GetMethodTable()->Collectible())
+        return;
+
+    SIZE_T size = pObject->GetSize();
+
+    AllocationSampleStackWalkData stackWalkData = { 2166136261, 0 };
+    Thread * pThread = GetThreadNULLOk();
+    if (pThread != NULL)
+    {
+        pThread->StackWalkFrames(AllocationSampleStackWalkCallback, &stackWalkData, FUNCTIONSONLY | QUICKUNWIND);
+    }
+
+    if (InterlockedCompareExchange(&s_lAllocationSamplesLock, 1, 0) != 0)
+    {
+        InterlockedExchangeAdd((LONG *)&s_cAllocationSamplesDropped, (LONG)cSamples);
+        return;
+    }
+
+    bool fRecorded = false;
+    UINT32 index = (UINT32)((((UINT64)th.AsTAddr() >> 3) * 0x9E3779B97F4A7C15ULL) >> 32) ^ stackWalkData.stackHash;
+    for (int iProbe = 0; iProbe < k_nAllocationSampleEntries; iProbe++)
+    {
+        AllocationSampleEntry * pEntry = &s_rgAllocationSamples[(index + iProbe) % k_nAllocationSampleEntries];
+        if (pEntry->th.IsNull())
+        {
+            pEntry->th = th;
+            pEntry->stackHash = stackWalkData.stackHash;
+        }
+        else if ((pEntry->th != th) || (pEntry->stackHash != stackWalkData.stackHash))
+        {
+            continue;
+        }
+
+        pEntry->sampleCount += cSamples;
+        pEntry->objectBytes += size;
+        fRecorded = true;
+        break;
+    }
+
+    VolatileStore(&s_lAllocationSamplesLock, (LONG)0);
+
+    if (!fRecorded)
+    {
+        InterlockedExchangeAdd((LONG *)&s_cAllocationSamplesDropped, (LONG)cSamples);
+    }
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Sends the allocation sample histogram as GCAllocationSampleHistogram events. The
+// histogram is cumulative since process start; the estimated number of bytes allocated
+// for an entry is SampleCount * SamplingInterval. Samples that didn't fit in the
+// histogram are sent last with a NULL TypeID.
+//
+
+// static
+VOID ETW::TypeSystemLog::SendAllocationSampleHistogram()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    // Entries are copied out in small batches so allocating threads that find the
+    // histogram busy drop as few samples as possible, and so no lock is held while
+    // their types are logged.
+    const int k_nBatchSize = 64;
+    AllocationSampleEntry rgBatch[k_nBatchSize];
+
+    int iEntry = 0;
+    while (iEntry < k_nAllocationSampleEntries)
+    {
+        int cBatch = 0;
+        {
+            DWORD dwSwitchCount = 0;
+            while (InterlockedCompareExchange(&s_lAllocationSamplesLock, 1, 0) != 0)
+            {
+                __SwitchToThread(0, ++dwSwitchCount);
+            }
+
+            for (; (iEntry < k_nAllocationSampleEntries) && (cBatch < k_nBatchSize); iEntry++)
+            {
+                if (!s_rgAllocationSamples[iEntry].th.IsNull())
+                {
+                    rgBatch[cBatch++] = s_rgAllocationSamples[iEntry];
+                }
+            }
+
+            VolatileStore(&s_lAllocationSamplesLock, (LONG)0);
+        }
+
+        for (int i = 0; i < cBatch; i++)
+        {
+            LogTypeAndParametersIfNecessary(NULL, rgBatch[i].th.AsTAddr(), kTypeLogBehaviorTakeLockAndLogIfFirstTime);
+            FireEtwGCAllocationSampleHistogram(
+                (LPVOID) rgBatch[i].th.AsTAddr(),
+                rgBatch[i].stackHash,
+                rgBatch[i].sampleCount,
+                rgBatch[i].objectBytes,
+                s_cbAllocationSamplingInterval,
+                GetClrInstanceId());
+        }
+    }
+
+    UINT32 cDropped = VolatileLoad(&s_cAllocationSamplesDropped);
+    if (cDropped != 0)
+    {
+        FireEtwGCAllocationSampleHistogram(NULL, 0, cDropped, 0, s_cbAllocationSamplingInterval, GetClrInstanceId());
+    }
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Accessor for global hash table crst
@@ -3385,7 +3639,7 @@ VOID ETW::MethodLog::GetR2RGetEntryPoint(MethodDesc *pMethodDesc, PCODE pEntryPo
         {
                 SendMethodDetailsEvent(pMethodDesc);
 
-                SString tNamespace, tMethodName, tMethodSignature;
+                StackSString tNamespace, tMethodName, tMethodSignature;
                 pMethodDesc->GetMethodInfo(tNamespace, tMethodName, tMethodSignature);
 
                 FireEtwR2RGetEntryPoint(
@@ -3466,7 +3720,7 @@ VOID ETW::MethodLog::LogMethodInstrumentationData(MethodDesc* method, uint32_t c
             else
                 ulMethodToken = (ULONG)method->GetMemberDef();
 
-            SString tNamespace, tMethodName, tMethodSignature;
+            StackSString tNamespace, tMethodName, tMethodSignature;
             method->GetMethodInfo(tNamespace, tMethodName, tMethodSignature);
 
             PCWSTR pNamespace = (PCWSTR)tNamespace.GetUnicode();
@@ -4568,7 +4822,7 @@ VOID ETW::MethodLog::SendMethodJitStartEvent(
         if (methodDecoder != NULL)
             ulMethodILSize = methodDecoder->GetCodeSize();
 
-        SString tNamespace, tMethodName, tMethodSignature;
+        StackSString tNamespace, tMethodName, tMethodSignature;
         if(!namespaceOrClassName|| !methodName|| !methodSignature || (methodName->IsEmpty() && namespaceOrClassName->IsEmpty() && methodSignature->IsEmpty()))
         {
             pMethodDesc->GetMethodInfo(tNamespace, tMethodName, tMethodSignature);
@@ -4711,7 +4965,7 @@ VOID ETW::MethodLog::SendMethodEvent(MethodDesc *pMethodDesc, DWORD dwEventOptio
     else
         ulMethodToken = (ULONG)pMethodDesc->GetMemberDef();
 
-    SString tNamespace, tMethodName, tMethodSignature;
+    StackSString tNamespace, tMethodName, tMethodSignature;
 
     // if verbose method load info needed, only then
     // find method name and signature and fire verbose method load info
@@ -8055,6 +8055,18 @@ extern "C" BOOL QCALLTYPE CallFilterFunclet(QCall::ObjectHandleOnStack exception
 }
 
 
+static PCODE GetCodeAddressForRelOffset(const IJitManager::MethodRegionInfo& methodRegionInfo, DWORD relOffset)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (relOffset < methodRegionInfo.hotSize)
+        return methodRegionInfo.hotStartAddress + relOffset;
+
+    SIZE_T coldOffset = relOffset - methodRegionInfo.hotSize;
+    _ASSERTE(coldOffset < methodRegionInfo.coldSize);
+    return methodRegionInfo.coldStartAddress + coldOffset;
+}
+
 struct ExtendedEHClauseEnumerator : EH_CLAUSE_ENUMERATOR
 {
     StackFrameIterator *pFrameIter;
@@ -8110,13 +8122,15 @@ extern "C" BOOL QCALLTYPE EHEnumNext(EH_CLAUSE_ENUMERATOR* pEHEnum, RhEHClause*
 
         pEHClause->_tryStartOffset = EHClause.TryStartPC;
         pEHClause->_tryEndOffset = EHClause.TryEndPC;
-        // TODO-NewEH: The GetCodeAddressForRelOffset is expensive when the code is hot/cold split. Postpone this to
-        // later when we really need the address.
+        // GetCodeAddressForRelOffset looks up the method regions on every call, which is expensive when the
+        // code is hot/cold split. Look them up once per clause and translate both offsets from that.
+        IJitManager::MethodRegionInfo methodRegionInfo;
+        pJitMan->JitTokenToMethodRegionInfo(MethToken, &methodRegionInfo);
         if (IsFilterHandler(&EHClause))
         {
-            pEHClause->_filterAddress =  (BYTE*)pJitMan->GetCodeAddressForRelOffset(MethToken, EHClause.FilterOffset);
+            pEHClause->_filterAddress = (BYTE*)GetCodeAddressForRelOffset(methodRegionInfo, EHClause.FilterOffset);
         }
-        pEHClause->_handlerAddress = (BYTE*)pJitMan->GetCodeAddressForRelOffset(MethToken, EHClause.HandlerStartPC);
+        pEHClause->_handlerAddress = (BYTE*)GetCodeAddressForRelOffset(methodRegionInfo, EHClause.HandlerStartPC);
 
         result = TRUE;
         pEHClause->_isSameTry = (EHClause.Flags & 0x10) != 0; // CORINFO_EH_CLAUSE_SAMETRY
@@ -31,11 +31,21 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+DWORD FinalizerThread::s_helperCount = 0;
+CLREvent * FinalizerThread::s_helperEvents = NULL;
+CLREvent * FinalizerThread::hEventFinalizerHelpersDone = NULL;
+LONG FinalizerThread::s_helpersBusy = 0;
+
+// 1-based index of the helper running on this thread, 0 on every other thread.
+static thread_local DWORD t_finalizerHelperIndex = 0;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThreadNULLOk() == g_pFinalizerThread;
+    // Helpers count as the finalizer thread so a finalizer running on one can't deadlock
+    // by waiting for pending finalizers.
+    return (GetThreadNULLOk() == g_pFinalizerThread) || (t_finalizerHelperIndex != 0);
 }
 
 void FinalizerThread::EnableFinalization()
@@ -98,7 +108,7 @@ Again:
     if (fQuitFinalizer)
         return NULL;
 
-    OBJECTREF obj = ObjectToOBJECTREF(GCHeapUtilities::GetGCHeap()->GetNextFinalizable());
+    OBJECTREF obj = ObjectToOBJECTREF(GetNextFinalizableForCurrentThread());
     if (obj == NULL)
         return NULL;
 
@@ -156,6 +166,163 @@ Again:
     return obj;
 }
 
+// Without helpers this is just GetNextFinalizable. With helpers, every thread takes normal
+// finalizers, starting at its own heap. Helpers never take critical ones. The finalizer thread
+// waits for the helpers to finish their pass before it moves on to critical finalizers, so
+// those still run after all the normal ones that were queued with them.
+Object* FinalizerThread::GetNextFinalizableForCurrentThread()
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    IGCHeap* pHeap = GCHeapUtilities::GetGCHeap();
+    if (s_helperCount == 0)
+        return pHeap->GetNextFinalizable();
+
+    Object* obj = pHeap->GetNextNonCriticalFinalizable((int)t_finalizerHelperIndex);
+    if ((obj != NULL) || (t_finalizerHelperIndex != 0))
+        return obj;
+
+    WaitForHelpers();
+    return pHeap->GetNextFinalizable();
+}
+
+void FinalizerThread::StartHelpers()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (s_helperCount == 0)
+        return;
+
+    hEventFinalizerHelpersDone->Reset();
+    InterlockedExchange(&s_helpersBusy, (LONG)s_helperCount);
+    for (DWORD i = 0; i < s_helperCount; i++)
+    {
+        s_helperEvents[i].Set();
+    }
+}
+
+void FinalizerThread::WaitForHelpers()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (VolatileLoad(&s_helpersBusy) == 0)
+        return;
+
+    GCX_PREEMP();
+    hEventFinalizerHelpersDone->Wait(INFINITE, FALSE);
+}
+
+// Helpers are only worth it if the GC can hand out normal finalizers on their own, which
+// an older standalone GC can't.
+void FinalizerThread::CreateHelperThreads()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD requested = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_FinalizerHelperThreads);
+    if ((requested == 0) || !GCHeapUtilities::GCInterfaceSupportsMinorVersion(3))
+        return;
+
+    DWORD count = min(requested, (DWORD)max(GetCurrentProcessCpuCount() - 1, 0));
+    if (count == 0)
+        return;
+
+    EX_TRY
+    {
+        hEventFinalizerHelpersDone = new CLREvent();
+        hEventFinalizerHelpersDone->CreateManualEvent(FALSE);
+        s_helperEvents = new CLREvent[count];
+
+        DWORD created = 0;
+        for (DWORD i = 0; i < count; i++)
+        {
+            s_helperEvents[i].CreateAutoEvent(FALSE);
+
+            Thread *pHelper = SetupUnstartedThread();
+            pHelper->SetBackground(TRUE);
+#ifdef FEATURE_COMINTEROP
+            pHelper->SetApartment(Thread::AS_InMTA);
+#endif // FEATURE_COMINTEROP
+
+            if (!pHelper->CreateNewThread(0, &FinalizerHelperThreadStart, (void*)(size_t)(i + 1), W(".NET Finalizer Helper")))
+            {
+                pHelper->DecExternalCount(FALSE);
+                break;
+            }
+
+            pHelper->StartThread();
+            created++;
+        }
+
+        // Only publish the threads that actually started so StartHelpers/WaitForHelpers
+        // never wait on a helper that doesn't exist.
+        s_helperCount = created;
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    LOG((LF_GC, LL_INFO10, "Started %d finalizer helper threads\n", s_helperCount));
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperThreadStart(void *args)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+
+    Thread *pThread = GetThread();
+    if (!pThread->HasStarted())
+        return 0;
+
+    t_finalizerHelperIndex = (DWORD)(size_t)args;
+    ManagedThreadBase::KickOff(FinalizerHelperThreadWorker, args);
+
+    GCX_PREEMP_NO_DTOR();
+    DestroyThread(pThread);
+    return 0;
+}
+
+void FinalizerThread::FinalizerHelperThreadWorker(void *args)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    DWORD index = (DWORD)(size_t)args;
+    _ASSERTE(index != 0);
+
+    while (!fQuitFinalizer)
+    {
+        {
+            GCX_PREEMP();
+            s_helperEvents[index - 1].Wait(INFINITE, FALSE);
+        }
+
+        if (!fQuitFinalizer)
+        {
+            // Runs finalizers until GetNextFinalizableForCurrentThread finds no normal ones left.
+            FinalizeAllObjects();
+        }
+
+        if (InterlockedDecrement(&s_helpersBusy) == 0)
+            hEventFinalizerHelpersDone->Set();
+    }
+}
+
 void FinalizerThread::FinalizeAllObjects()
 {
     STATIC_CONTRACT_THROWS;
@@ -369,6 +536,7 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         {
             s_InitializedFinalizerThreadForPlatform = TRUE;
             Thread::InitializationForManagedThreadInNative(GetFinalizerThread());
+            CreateHelperThreads();
         }
 
         JitHost::Reclaim();
@@ -404,7 +572,9 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         }
         LOG((LF_GC, LL_INFO100, "***** Calling Finalizers\n"));
 
+        StartHelpers();
         FinalizeAllObjects();
+        WaitForHelpers();
 
         // Anyone waiting to drain the Q can now wake up.  Note that there is a
         // race in that another thread starting a drain, as we leave a drain, may
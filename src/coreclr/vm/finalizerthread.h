@@ -34,6 +34,20 @@ class FinalizerThread
 
     static void FinalizeAllObjects();
 
+    // Optional helper threads (FinalizerHelperThreads) that run normal finalizers alongside
+    // the finalizer thread. Each one starts draining at a different heap's queue.
+    static DWORD s_helperCount;
+    static CLREvent *s_helperEvents;
+    static CLREvent *hEventFinalizerHelpersDone;
+    static LONG s_helpersBusy;
+
+    static void CreateHelperThreads();
+    static void StartHelpers();
+    static void WaitForHelpers();
+    static Object* GetNextFinalizableForCurrentThread();
+    static DWORD WINAPI FinalizerHelperThreadStart(void *args);
+    static void FinalizerHelperThreadWorker(void *args);
+
 public:
     static Thread* GetFinalizerThread()
     {
@@ -693,6 +693,14 @@ void ScanHandleForProfilerAndETW(Object** pRef, Object* pSec, uint32_t flags, Sc
 void GCProfileWalkHeapWorker(BOOL fProfilerPinned, BOOL fShouldWalkHeapRootsForEtw, BOOL fShouldWalkHeapObjectsForEtw)
 {
     {
+#ifdef FEATURE_PERFTRACING
+        // A heap dump is only usable if every root/node/edge event makes it into the
+        // stream, so make this thread wait for the EventPipe streaming thread to drain
+        // buffers instead of dropping events when a session's buffers are full.
+        bool fEtwWalk = fShouldWalkHeapRootsForEtw || fShouldWalkHeapObjectsForEtw;
+        bool fPreviousLosslessWrites = fEtwWalk ? EventPipeAdapter::SetLosslessWritesForCurrentThread(true) : false;
+#endif // FEATURE_PERFTRACING
+
         ProfilingScanContext SC(fProfilerPinned);
         unsigned max_generation = GCHeapUtilities::GetGCHeap()->GetMaxGeneration();
 
@@ -758,6 +766,13 @@ void GCProfileWalkHeapWorker(BOOL fProfilerPinned, BOOL fShouldWalkHeapRootsForE
             ETW::GCLog::EndHeapDump(&profilerWalkHeapContext);
         }
 #endif // FEATURE_EVENT_TRACE
+
+#ifdef FEATURE_PERFTRACING
+        if (fEtwWalk)
+        {
+            EventPipeAdapter::SetLosslessWritesForCurrentThread(fPreviousLosslessWrites);
+        }
+#endif // FEATURE_PERFTRACING
     }
 }
 #endif // defined(GC_PROFILING) || defined(FEATURE_EVENT_TRACE)
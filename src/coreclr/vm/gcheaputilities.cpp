@@ -66,6 +66,14 @@ PTR_VOID g_gc_module_base;
 
 bool GCHeapUtilities::s_useThreadAllocationContexts;
 
+bool GCHeapUtilities::GCInterfaceSupportsMinorVersion(uint32_t minorVersion)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return (g_gc_version_info.MajorVersion > GC_INTERFACE_MAJOR_VERSION) ||
+           ((g_gc_version_info.MajorVersion == GC_INTERFACE_MAJOR_VERSION) && (g_gc_version_info.MinorVersion >= minorVersion));
+}
+
 // GC entrypoints for the linked-in GC. These symbols are invoked
 // directly if we are not using a standalone GC.
 extern "C" void LOCALGC_CALLCONV GC_VersionInfo(/* Out */ VersionInfo* info);
@@ -128,6 +128,11 @@ public:
         return s_useThreadAllocationContexts;
     }
 
+    // Returns true if the loaded GC implements at least the given minor version of IGCHeap.
+    // Only needed for methods added after GC_INTERFACE_MAJOR_VERSION was last bumped since
+    // an older standalone GC can still be loaded.
+    static bool GCInterfaceSupportsMinorVersion(uint32_t minorVersion);
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
     // Returns True if software write watch is currently enabled for the GC Heap,
@@ -339,6 +339,11 @@ void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
     }
+
+    if (ETW::TypeSystemLog::IsAllocationSamplingEnabled())
+    {
+        ETW::TypeSystemLog::SampleObjectAllocationIfNecessary(orObject);
+    }
 #endif // FEATURE_EVENT_TRACE
 }
 
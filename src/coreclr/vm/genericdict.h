@@ -94,6 +94,15 @@ typedef DPTR(DictionaryLayout) PTR_DictionaryLayout;
 #define NUM_DICTIONARY_SLOTS 4
 #endif
 
+// Generic method dictionary layouts are sized up front from the IL size of the method, assuming
+// one slot per IL_BYTES_PER_DICTIONARY_SLOT bytes of IL, up to MAX_INITIAL_DICTIONARY_SLOTS.
+// Instructions that need a lookup (call, newobj, ldtoken, box, castclass, ...) are 5 bytes
+// each and sit among the loads, stores and branches that feed them, and repeated lookups share
+// a slot, so 32 bytes of IL rarely need more than one new slot. A slot costs one pointer per
+// instantiation, so the cap bounds the overallocation at 32 pointers per instantiation.
+#define IL_BYTES_PER_DICTIONARY_SLOT 32
+#define MAX_INITIAL_DICTIONARY_SLOTS 32
+
 // The type of dictionary layouts. We don't include the number of type
 // arguments as this is obtained elsewhere
 class DictionaryLayout
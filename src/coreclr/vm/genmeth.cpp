@@ -61,6 +61,24 @@
 //
 
 
+// Number of slots for a new generic method dictionary layout. Slots beyond the initial ones need a
+// size check in jitted code, and every dictionary allocated before the layout grew takes the slow
+// helper path to expand on first use of such a slot, so larger methods get a larger layout up front.
+static WORD GetInitialMethodDictionarySlots(MethodDesc *pGenericMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    // Debug and release builds size the layout the same way so both run the same lookup paths;
+    // methods needing more slots than estimated still go through the expansion logic.
+    if (!pGenericMD->HasILHeader())
+        return NUM_DICTIONARY_SLOTS;
+
+    COR_ILMETHOD_DECODER header(pGenericMD->GetILHeader(), pGenericMD->GetMDImport(), NULL);
+    DWORD numSlots = header.GetCodeSize() / IL_BYTES_PER_DICTIONARY_SLOT;
+
+    return (WORD)min(max(numSlots, (DWORD)NUM_DICTIONARY_SLOTS), (DWORD)MAX_INITIAL_DICTIONARY_SLOTS);
+}
+
 // Helper method that creates a method-desc off a template method desc
 static MethodDesc* CreateMethodDesc(LoaderAllocator *pAllocator,
                                     MethodTable *pMT,
@@ -378,7 +396,7 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             }
             else if (getWrappedCode)
             {
-                pDL = DictionaryLayout::Allocate(NUM_DICTIONARY_SLOTS, pAllocator, &amt);
+                pDL = DictionaryLayout::Allocate(GetInitialMethodDictionarySlots(pGenericMDescInRepMT), pAllocator, &amt);
 #ifdef _DEBUG
                 {
                     SString name;
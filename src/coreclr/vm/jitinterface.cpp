@@ -10777,7 +10777,7 @@ void CEEJitInfo::WriteCode(EEJitManager * jitMgr)
     WriteCodeBytes();
 
     // Now that the code header was written to the final location, publish the code via the nibble map
-    jitMgr->NibbleMapSet(m_pCodeHeap, m_CodeHeader->GetCodeStartAddress(), TRUE);
+    jitMgr->NibbleMapSet(m_pCodeHeap, m_CodeHeader->GetCodeStartAddress(), TRUE, m_codeSize);
 
 #if defined(TARGET_AMD64)
     // Publish the new unwind information in a way that the ETW stack crawler can find
@@ -10870,6 +10870,56 @@ void CEEJitInfo::reportMetadata(
 
     JIT_TO_EE_TRANSITION_LEAF();
 
+    if ((strcmp(key, "ThroughputSummary") == 0) && (length == sizeof(CorJitThroughputSummary)) &&
+        ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, MethodJitThroughputSummary))
+    {
+        const CorJitThroughputSummary* summary = static_cast<const CorJitThroughputSummary*>(value);
+
+        ULONGLONG ullMethodIdentifier = 0;
+        ULONGLONG ullModuleID = 0;
+
+        if (m_pMethodBeingCompiled)
+        {
+            Module* pModule = m_pMethodBeingCompiled->GetModule();
+            ullModuleID = (ULONGLONG)(TADDR)pModule;
+            ullMethodIdentifier = (ULONGLONG)m_pMethodBeingCompiled;
+        }
+
+        static_assert_no_msg(CORJIT_THROUGHPUT_SUMMARY_PHASES == 5);
+        const char* phaseNames[CORJIT_THROUGHPUT_SUMMARY_PHASES];
+        for (int i = 0; i < CORJIT_THROUGHPUT_SUMMARY_PHASES; i++)
+        {
+            phaseNames[i] = (summary->phaseNames[i] != NULL) ? summary->phaseNames[i] : "";
+        }
+
+        FireEtwMethodJitThroughputSummary(ullMethodIdentifier, ullModuleID,
+            summary->ilCodeSize, summary->nativeCodeSize, summary->totalMicroseconds,
+            phaseNames[0], summary->phaseMicroseconds[0],
+            phaseNames[1], summary->phaseMicroseconds[1],
+            phaseNames[2], summary->phaseMicroseconds[2],
+            phaseNames[3], summary->phaseMicroseconds[3],
+            phaseNames[4], summary->phaseMicroseconds[4],
+            GetClrInstanceId());
+    }
+    else if ((strcmp(key, "OSRDeclined") == 0) && (length == sizeof(CorJitOSRDeclined)) &&
+        ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, MethodJitOSRDeclined))
+    {
+        const CorJitOSRDeclined* declined = static_cast<const CorJitOSRDeclined*>(value);
+
+        ULONGLONG ullMethodIdentifier = 0;
+        ULONGLONG ullModuleID = 0;
+
+        if (m_pMethodBeingCompiled)
+        {
+            Module* pModule = m_pMethodBeingCompiled->GetModule();
+            ullModuleID = (ULONGLONG)(TADDR)pModule;
+            ullMethodIdentifier = (ULONGLONG)m_pMethodBeingCompiled;
+        }
+
+        FireEtwMethodJitOSRDeclined(ullMethodIdentifier, ullModuleID, declined->ilOffset,
+            (declined->reason != NULL) ? declined->reason : "", GetClrInstanceId());
+    }
+
     EE_TO_JIT_TRANSITION_LEAF();
 }
 
@@ -11191,6 +11241,11 @@ void CEEJitInfo::allocUnwindInfo (
             _ASSERTE((   RUNTIME_FUNCTION__BeginAddress(pOtherFunction) >= RUNTIME_FUNCTION__EndAddress(pRuntimeFunction, baseAddress + writeableOffset)
                      || RUNTIME_FUNCTION__EndAddress(pOtherFunction, baseAddress + writeableOffset) <= RUNTIME_FUNCTION__BeginAddress(pRuntimeFunction)));
         }
+
+        // EEJitManager::LazyGetFunctionEntry binary searches the unwind infos, so they must be
+        // emitted in code address order.
+        PT_RUNTIME_FUNCTION pPreviousFunction = m_CodeHeaderRW->GetUnwindInfo(m_usedUnwindInfos - 2);
+        _ASSERTE(RUNTIME_FUNCTION__EndAddress(pPreviousFunction, baseAddress + writeableOffset) <= RUNTIME_FUNCTION__BeginAddress(pRuntimeFunction));
     }
 #endif // _DEBUG
 
@@ -12163,9 +12218,7 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
 
     _ASSERTE((SIZE_T)(current - (BYTE *)m_CodeHeader->GetCodeStartAddress()) <= totalSize.Value());
 
-#ifdef _DEBUG
     m_codeSize = codeSize;
-#endif  // _DEBUG
 
     EE_TO_JIT_TRANSITION();
 }
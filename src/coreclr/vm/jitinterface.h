@@ -801,6 +801,7 @@ public:
           m_fJumpStubOverflow(FALSE),
           m_reserveForJumpStubs(0),
 #endif
+          m_codeSize(0),
           m_GCinfo_len(0),
           m_EHinfo_len(0),
           m_iOffsetMapping(0),
@@ -952,9 +953,7 @@ protected :
     size_t                  m_reserveForJumpStubs; // Space to reserve for jump stubs when allocating code
 #endif
 
-#if defined(_DEBUG)
     ULONG                   m_codeSize;     // Code size requested via allocMem
-#endif
 
     size_t                  m_GCinfo_len;   // Cached copy of GCinfo_len so we can backout in BackoutJitData()
     size_t                  m_EHinfo_len;   // Cached copy of EHinfo_len so we can backout in BackoutJitData()
@@ -579,17 +579,24 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
         // handles first
         pDomainLoaderAllocatorDestroyIterator->CleanupDependentHandlesToNativeObjects();
 
-        // The following code was previously happening on delete ~DomainAssembly->Terminate
-        // We are moving this part here in order to make sure that we can unload a LoaderAllocator
-        // that didn't have a DomainAssembly
-        // (we have now a LoaderAllocator with 0-n DomainAssembly)
+        pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+    }
+
+    // The following code was previously happening on delete ~DomainAssembly->Terminate
+    // We are moving this part here in order to make sure that we can unload a LoaderAllocator
+    // that didn't have a DomainAssembly
+    // (we have now a LoaderAllocator with 0-n DomainAssembly)
 
-        // This cleanup code starts resembling parts of AppDomain::Terminate too much.
-        // It would be useful to reduce duplication and also establish clear responsibilities
-        // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
-        // and LoaderAllocator::~LoaderAllocator. We need to establish how these
-        // cleanup paths interact with app-domain unload and process tear-down, too.
+    // This cleanup code starts resembling parts of AppDomain::Terminate too much.
+    // It would be useful to reduce duplication and also establish clear responsibilities
+    // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
+    // and LoaderAllocator::~LoaderAllocator. We need to establish how these
+    // cleanup paths interact with app-domain unload and process tear-down, too.
 
+    // All the LoaderAllocators collected here are unloaded under a single EE suspension, so unloading
+    // many of them at once doesn't pay for a suspension and a cache flush per LoaderAllocator.
+    if (pFirstDestroyedLoaderAllocator != NULL)
+    {
         if (!IsAtProcessExit())
         {
             // Suspend the EE to do some clean up that can only occur
@@ -604,10 +611,15 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             CastCache::FlushCurrentCache();
         }
 
-        ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
-        pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+        pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+        while (pDomainLoaderAllocatorDestroyIterator != NULL)
+        {
+            ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
+            pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+
+            pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+        }
 
-        // TODO: Do we really want to perform this on each LoaderAllocator?
         MethodTable::ClearMethodDataCache();
         ClearJitGenericHandleCache();
 
@@ -616,7 +628,11 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             // Resume the EE.
             ThreadSuspend::RestartEE(FALSE, TRUE);
         }
+    }
 
+    pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+    while (pDomainLoaderAllocatorDestroyIterator != NULL)
+    {
         // Because RegisterLoaderAllocatorForDeletion is modifying m_pLoaderAllocatorDestroyNext, we are saving it here
         LoaderAllocator* pLoaderAllocatorDestroyNext = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
 
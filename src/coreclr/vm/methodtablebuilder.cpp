@@ -3870,13 +3870,18 @@ VOID    MethodTableBuilder::InitializeFieldDescs(FieldDesc *pFieldDescList,
 
             HRESULT hr;
 
-            hr = GetCustomAttribute(bmtMetaData->pFields[i],
-                                    WellKnownAttribute::ThreadStatic,
-                                    NULL, NULL);
-            IfFailThrow(hr);
-            if (hr == S_OK)
+            // EnumerateClassFields already counted the thread statics, so skip the custom attribute
+            // lookup when there are none. Fields added by EnC are not part of that count.
+            if (isEnCField || bmtEnumFields->dwNumThreadStaticFields != 0)
             {
-                fIsThreadStatic = TRUE;
+                hr = GetCustomAttribute(bmtMetaData->pFields[i],
+                                        WellKnownAttribute::ThreadStatic,
+                                        NULL, NULL);
+                IfFailThrow(hr);
+                if (hr == S_OK)
+                {
+                    fIsThreadStatic = TRUE;
+                }
             }
 
 
@@ -42,6 +42,7 @@ const int      HEADER_D_COUNTER  = 3;               // Extra 32-bit counters in
 
 const int      MULTICOREJITLIFE  = 60 * 1000;       // 60 seconds
 const int      MAX_WALKBACK      = 128;
+const int      MAX_PLAYER_THREADS = 8;              // Upper bound on threads (including the main player thread) compiling methods
 
 enum
 {
@@ -285,6 +286,14 @@ private:
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
 
+    // Methods resolved by the main player thread, waiting to be compiled by helper threads
+    CrstExplicitInit                   m_crstPending;   // protecting m_pendingMethods and m_nNextPending
+    SArray<MethodDesc *>               m_pendingMethods;
+    COUNT_T                            m_nNextPending;
+    CLREvent                           m_pendingEvent;
+    Volatile<bool>                     m_fProducerDone;
+    LONG                               m_nActiveHelpers;
+
     HRESULT HandleModuleRecord(const ModuleRecord * pMod);
     HRESULT HandleModuleInfoRecord(unsigned moduleTo, unsigned level);
     HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token);
@@ -292,8 +301,17 @@ private:
     void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric);
 
     bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+    void PrepareMethodCode(MethodDesc * pMD);
     HRESULT PlayProfile();
 
+    void StartHelperThreads();
+    void StopHelperThreads();
+    MethodDesc * TryDequeuePendingMethod();
+    void DrainPendingMethods();
+    void HelperThreadProc();
+
+    static DWORD WINAPI StaticHelperThreadProc(void *args);
+
     bool ShouldAbort(bool fast) const;
 
     HRESULT JITThreadProc(Thread * pThread);
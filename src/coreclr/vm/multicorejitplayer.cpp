@@ -382,6 +382,10 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AssemblyBinder * pBinder, L
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
 
+    m_nNextPending       = 0;
+    m_fProducerDone      = false;
+    m_nActiveHelpers     = 0;
+
     m_nStartTime         = GetTickCount();
 }
 
@@ -400,6 +404,13 @@ MulticoreJitProfilePlayer::~MulticoreJitProfilePlayer()
     {
         delete [] m_pFileBuffer;
     }
+
+    // The event and lock are only created when helper threads are used
+    if (m_pendingEvent.IsValid())
+    {
+        m_pendingEvent.CloseEvent();
+        m_crstPending.Destroy();
+    }
 }
 
 
@@ -576,12 +587,20 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
 
         m_stats.m_nTryCompiling ++;
 
-        // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
-        ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
+        if (m_nActiveHelpers > 0)
+        {
+            // Hand the method to the helper threads, this thread keeps resolving records (and loading the modules
+            // they depend on) in profile order
+            {
+                CrstHolder holder(&m_crstPending);
+                m_pendingMethods.Append(pMD);
+            }
+            m_pendingEvent.Set();
+
+            return true;
+        }
 
-        // PrepareCode calls back to MulticoreJitCodeStorage::StoreMethodCode under MethodDesc lock
-        MulticoreJitPrepareCodeConfig config(pMD);
-        pMD->PrepareCode(&config);
+        PrepareMethodCode(pMD);
 
         return true;
     }
@@ -589,6 +608,18 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
     return false;
 }
 
+void MulticoreJitProfilePlayer::PrepareMethodCode(MethodDesc * pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
+    ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
+
+    // PrepareCode calls back to MulticoreJitCodeStorage::StoreMethodCode under MethodDesc lock
+    MulticoreJitPrepareCodeConfig config(pMD);
+    pMD->PrepareCode(&config);
+}
+
 class MulticoreJitPlayerModuleEnumerator : public MulticoreJitModuleEnumerator
 {
     MulticoreJitProfilePlayer * m_pPlayer;
@@ -947,6 +978,12 @@ void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodD
 {
     STANDARD_VM_CONTRACT;
 
+    if (pMethod != NULL && isGeneric && pMethod->IsWrapperStub())
+    {
+        // An instantiation over shared types decodes to an instantiating stub, compile the shared code it wraps
+        pMethod = pMethod->GetWrappedMethodDesc();
+    }
+
     if (pMethod != NULL && MulticoreJitManager::IsMethodSupported(pMethod))
     {
         if (!isGeneric)
@@ -1325,6 +1362,198 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
 }
 
 
+struct MulticoreJitHelperThreadArgs
+{
+    MulticoreJitProfilePlayer * m_pPlayer;
+    Thread                    * m_pThread;
+};
+
+void MulticoreJitProfilePlayer::StartHelperThreads()
+{
+    STANDARD_VM_CONTRACT;
+
+    DWORD threadCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPlayerThreadCount);
+    threadCount = min(threadCount, (DWORD) GetCurrentProcessCpuCount());
+    threadCount = min(threadCount, (DWORD) MAX_PLAYER_THREADS);
+
+    if (threadCount <= 1)
+    {
+        return;
+    }
+
+    m_crstPending.Init(CrstMulticoreJitHash);
+    m_pendingEvent.CreateAutoEvent(FALSE);
+
+    // This thread is one of the threads compiling methods
+    for (DWORD i = 1; i < threadCount; i ++)
+    {
+        InterlockedIncrement(&m_nActiveHelpers);
+
+        EX_TRY
+        {
+            MulticoreJitHelperThreadArgs * pArgs = new MulticoreJitHelperThreadArgs();
+            pArgs->m_pPlayer = this;
+            pArgs->m_pThread = SetupUnstartedThread();
+
+            if (!pArgs->m_pThread->CreateNewThread(0, StaticHelperThreadProc, pArgs))
+            {
+                pArgs->m_pThread->DecExternalCount(false);
+                delete pArgs;
+                ThrowOutOfMemory();
+            }
+
+            pArgs->m_pThread->StartThread();
+        }
+        EX_CATCH
+        {
+            InterlockedDecrement(&m_nActiveHelpers);
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+
+    MulticoreJitTrace(("StartHelperThreads: %d helper threads", m_nActiveHelpers));
+}
+
+MethodDesc * MulticoreJitProfilePlayer::TryDequeuePendingMethod()
+{
+    STANDARD_VM_CONTRACT;
+
+    CrstHolder holder(&m_crstPending);
+
+    if (m_nNextPending == m_pendingMethods.GetCount())
+    {
+        return NULL;
+    }
+
+    MethodDesc * pMD = m_pendingMethods[m_nNextPending ++];
+
+    if (m_nNextPending == m_pendingMethods.GetCount())
+    {
+        // Queue drained, reuse the storage
+        m_pendingMethods.Clear();
+        m_nNextPending = 0;
+    }
+
+    return pMD;
+}
+
+void MulticoreJitProfilePlayer::DrainPendingMethods()
+{
+    STANDARD_VM_CONTRACT;
+
+    MethodDesc * pMD;
+
+    while (!ShouldAbort(false) && ((pMD = TryDequeuePendingMethod()) != NULL))
+    {
+        // A method failing to compile should not stop the others in the queue
+        EX_TRY
+        {
+            // The same method may have been queued twice by records of different instantiations
+            if (pMD->GetNativeCode() == (PCODE)NULL &&
+                !GetAppDomain()->GetMulticoreJitManager().GetMulticoreJitCodeStorage().LookupMethodCode(pMD))
+            {
+                PrepareMethodCode(pMD);
+            }
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+}
+
+void MulticoreJitProfilePlayer::HelperThreadProc()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    EX_TRY
+    {
+        // Go into preemptive mode
+        GCX_PREEMP();
+
+        while (true)
+        {
+            DrainPendingMethods();
+
+            if (m_fProducerDone || ShouldAbort(false))
+            {
+                // The main player thread stops producing before setting the flag, drain once more for anything
+                // queued in between
+                DrainPendingMethods();
+                break;
+            }
+
+            m_pendingEvent.Wait(10, FALSE);
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+}
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticHelperThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+    }
+    CONTRACTL_END;
+
+    MulticoreJitHelperThreadArgs * pArgs = (MulticoreJitHelperThreadArgs *) args;
+    MulticoreJitProfilePlayer * pPlayer = pArgs->m_pPlayer;
+    Thread * pThread = pArgs->m_pThread;
+    delete pArgs;
+
+    if (pThread->HasStarted())
+    {
+        // Disable calling managed code in background thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        pPlayer->HelperThreadProc();
+    }
+
+    DestroyThread(pThread);
+
+    // The main player thread deletes the player once all helpers are gone, it must not be touched after this
+    InterlockedDecrement(&pPlayer->m_nActiveHelpers);
+
+    return 0;
+}
+
+void MulticoreJitProfilePlayer::StopHelperThreads()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!m_pendingEvent.IsValid())
+    {
+        return;
+    }
+
+    m_fProducerDone = true;
+    m_pendingEvent.Set();
+
+    // Help with the remaining methods, then wait for the helpers to finish theirs
+    DrainPendingMethods();
+
+    while (VolatileLoad(&m_nActiveHelpers) != 0)
+    {
+        ClrSleepEx(1, FALSE);
+    }
+}
+
 HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
 {
     CONTRACTL
@@ -1344,6 +1573,8 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
             // Go into preemptive mode
             GCX_PREEMP();
 
+            StartHelperThreads();
+
             m_stats.m_hr = PlayProfile();
         }
     }
@@ -1356,6 +1587,21 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
     }
     EX_END_CATCH(SwallowAllExceptions);
 
+    {
+        GCX_PREEMP();
+
+        // The player is deleted once this returns, wait for the helper threads even if playing back failed
+        StopHelperThreads();
+    }
+
+    // Report how many of the methods compiled in the background were used by the time the player finished
+    MulticoreJitCodeStorage & curStorage = GetAppDomain()->GetMulticoreJitManager().GetMulticoreJitCodeStorage();
+
+    unsigned stored   = curStorage.GetStored();
+    unsigned returned = curStorage.GetReturned();
+
+    _FireEtwMulticoreJit(W("PLAYERHITRATE"), W(""), stored, returned, (stored == 0) ? 0 : returned * 100 / stored);
+
     return (DWORD) m_stats.m_hr;
 }
 
@@ -202,6 +202,14 @@ PerfMap::PerfMap()
 
     // Initialize with no failures.
     m_ErrorEncountered = false;
+
+    m_BufferUsed = 0;
+    m_BufferSize = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapBufferSize);
+    m_Buffer = (m_BufferSize != 0) ? new (nothrow) BYTE[m_BufferSize] : nullptr;
+    if (m_Buffer == nullptr)
+    {
+        m_BufferSize = 0;
+    }
 }
 
 // Clean-up resources.
@@ -209,8 +217,13 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    Flush();
+
     delete m_FileStream;
     m_FileStream = nullptr;
+
+    delete [] m_Buffer;
+    m_Buffer = nullptr;
 }
 
 void PerfMap::OpenFileForPid(int pid, const char* basePath)
@@ -255,24 +268,61 @@ void PerfMap::WriteLine(SString& line)
 
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
         const char * strLine = line.GetUTF8();
         ULONG inCount = line.GetCount();
-        ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
 
-        if (inCount != outCount)
+        if (inCount > m_BufferSize - m_BufferUsed)
         {
-            // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
-            m_ErrorEncountered = true;
+            Flush();
         }
 
+        if (inCount <= m_BufferSize - m_BufferUsed)
+        {
+            memcpy(m_Buffer + m_BufferUsed, strLine, inCount);
+            m_BufferUsed += inCount;
+        }
+        else
+        {
+            WriteToFile(strLine, inCount);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
 
+// Write raw bytes to the map file.
+void PerfMap::WriteToFile(const void * pData, ULONG cbData)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (m_FileStream == nullptr || m_ErrorEncountered)
+    {
+        return;
+    }
+
+    // The PAL already takes a lock when writing, so we don't need to do so here.
+    ULONG outCount;
+    m_FileStream->Write(pData, cbData, &outCount);
+
+    if (cbData != outCount)
+    {
+        // This will cause us to stop writing to the file.
+        // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+        m_ErrorEncountered = true;
+    }
+}
+
+// Write any buffered lines to the map file.
+void PerfMap::Flush()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (m_BufferUsed != 0)
+    {
+        WriteToFile(m_Buffer, m_BufferUsed);
+        m_BufferUsed = 0;
+    }
+}
+
 void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, PrepareCodeConfig *pConfig)
 {
     LIMITED_METHOD_CONTRACT;
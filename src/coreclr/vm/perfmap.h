@@ -33,6 +33,11 @@ private:
     // Set to true if an error is encountered when writing to the file.
     bool m_ErrorEncountered;
 
+    // Optional buffer of pending map lines, used to batch writes to the file (see PerfMapBufferSize).
+    BYTE * m_Buffer;
+    ULONG m_BufferSize;
+    ULONG m_BufferUsed;
+
     // Construct a new map
     PerfMap();
 
@@ -42,6 +47,12 @@ private:
     // Write a line to the map file.
     void WriteLine(SString & line);
 
+    // Write raw bytes to the map file, bypassing the buffer.
+    void WriteToFile(const void * pData, ULONG cbData);
+
+    // Write any buffered lines to the map file.
+    void Flush();
+
     // Default to /tmp or use DOTNET_PerfMapJitDumpPath if set
     static const char* InternalConstructPath();
 
@@ -52,6 +52,7 @@ const char* const         PgoManager::s_TypeHandle = "TypeHandle: %s\n";
 
 
 PtrSHash<PgoManager::Header, PgoManager::CodeAndMethodHash> PgoManager::s_textFormatPgoData;
+bool PgoManager::s_startOptimizedWithTextFormatData = false;
 CrstStatic PgoManager::s_pgoMgrLock;
 PgoManager PgoManager::s_InitialPgoManager;
 
@@ -351,9 +352,14 @@ void ReadLineAndDiscard(FILE* file)
 #ifndef DACCESS_COMPILE
 void PgoManager::ReadPgoData()
 {
-    // Skip, if we're not reading, or we're writing profile data, or doing tiered pgo
+    // Skip, if we're not reading, or we're writing profile data, or doing tiered pgo.
     //
-    if (g_pConfig->TieredPGO() ||
+    // Tiered pgo may be combined with saved data when methods that have saved data
+    // start out optimized; the remaining methods are instrumented as usual.
+    //
+    const bool startOptimized = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadPGODataStartOptimized) > 0;
+
+    if ((g_pConfig->TieredPGO() && !startOptimized) ||
         (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0) ||
         (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadPGOData) == 0))
     {
@@ -621,6 +627,31 @@ void PgoManager::ReadPgoData()
         s_textFormatPgoData.Add(methodData);
         probes += schemaCount;
     }
+
+    s_startOptimizedWithTextFormatData = startOptimized;
+}
+
+bool PgoManager::ShouldStartOptimized(MethodDesc* pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!s_startOptimizedWithTextFormatData || (s_textFormatPgoData.GetCount() == 0))
+    {
+        return false;
+    }
+
+    int codehash;
+    unsigned ilSize;
+    if (!GetVersionResilientILCodeHashCode(pMD, &codehash, &ilSize))
+    {
+        return false;
+    }
+
+    Header* found = s_textFormatPgoData.Lookup(CodeAndMethodHash(codehash, pMD->GetStableHash()));
+
+    // A method whose IL changed since the data was written keeps tiering normally.
+    //
+    return (found != NULL) && (found->ilSize == ilSize);
 }
 #endif // DACCESS_COMPILE
 
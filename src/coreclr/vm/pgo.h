@@ -18,6 +18,10 @@ public:
     static void Initialize();
     static void Shutdown();
 
+    // True if the method should skip the tier0 and instrumented tiers because
+    // profile data for it was read from PGODataPath at startup.
+    static bool ShouldStartOptimized(MethodDesc* pMD);
+
 #endif // FEATURE_PGO
 
 public:
@@ -178,6 +182,7 @@ private:
     static PgoManager s_InitialPgoManager;
 
     static PtrSHash<Header, CodeAndMethodHash> s_textFormatPgoData;
+    static bool s_startOptimizedWithTextFormatData;
 
     PgoManager *m_next = NULL;
     PgoManager *m_prev = NULL;
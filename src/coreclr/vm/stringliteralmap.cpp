@@ -158,13 +158,19 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     HashDatum Data;
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+    // Only collectible maps keep entries of their own. Check ours without taking the global lock first, so
+    // that repeated lookups of the same literal from a collectible module don't contend on the global map.
+    if (bIsCollectible && m_StringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+    {
+        STRINGREF *pStrObj = ((StringLiteralEntry*)Data)->GetStringObject();
+        _ASSERTE(!bAddIfNotFound || pStrObj);
+        return pStrObj;
+    }
+
     // Retrieve the string literal from the global string literal map.
     CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
-    // TODO: We can be more efficient by checking our local hash table now to see if
-    // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-    // (Rather than waiting until after we look the string up in the global map)
-
     // Don't use FOH for collectible modules to avoid potential memory leaks
     const bool preferFrozenObjectHeap = !bIsCollectible;
     StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound, preferFrozenObjectHeap));
@@ -175,9 +181,8 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     if (pEntry)
     {
         // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-        // hashentry in the appdomain specific map.
-        // TODO: except that by not inserting into our local table we always take the global map lock
-        // and come into this path, when we could succeed at a lock free lookup above.
+        // hashentry in the appdomain specific map. Collectible maps do add one, which is what lets later lookups of
+        // the literal succeed in the lock free lookup above.
 
         if (bIsCollectible)
         {
@@ -259,9 +264,8 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
         if (pEntry)
         {
             // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-            // hashentry in the appdomain specific map.
-            // TODO: except that by not inserting into our local table we always take the global map lock
-            // and come into this path, when we could succeed at a lock free lookup above.
+            // hashentry in the appdomain specific map. Collectible maps do add one, which is what lets later lookups of
+            // the string succeed in the lock free lookup above.
 
             if (bIsCollectible)
             {
@@ -1194,7 +1194,7 @@ void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintp
             GCWeakPtrScanElement (nb, scanProc, lp1, lp2, fSetSyncBlockCleanup);
         }
 
-
+        TrimFreeSyncTableEntries();
     }
 
     if (fSetSyncBlockCleanup)
@@ -1223,6 +1223,55 @@ void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintp
 #endif // VERIFY_HEAP
 }
 
+// Called during a full GC once dead entries have been freed, while we have exclusive access to the table.
+// Lowers the high-water mark below any free entries at the end of the table, so that later GCs don't scan
+// them, and rebuilds the free list lowest index first so that new sync blocks pack the bottom of the table.
+void SyncBlockCache::TrimFreeSyncTableEntries()
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    SyncTableEntry* pSyncTable = SyncTableEntry::GetSyncTableEntry();
+
+    DWORD newFreeSyncTableIndex = m_FreeSyncTableIndex;
+    while ((newFreeSyncTableIndex > 1) && ((size_t)pSyncTable[newFreeSyncTableIndex - 1].m_Object.Load() & 1))
+    {
+        newFreeSyncTableIndex--;
+    }
+
+    if (newFreeSyncTableIndex == m_FreeSyncTableIndex)
+    {
+        return;
+    }
+
+    STRESS_LOG2(LF_GC | LF_SYNC, LL_INFO100, "SyncBlockCache trimming free entries [%d, %d)\n", newFreeSyncTableIndex, m_FreeSyncTableIndex);
+
+    size_t freeSyncTableList = 0;
+    for (DWORD nb = newFreeSyncTableIndex - 1; nb > 0; nb--)
+    {
+        if ((size_t)pSyncTable[nb].m_Object.Load() & 1)
+        {
+            pSyncTable[nb].m_Object = (Object *)(freeSyncTableList | 1);
+            freeSyncTableList = nb << 1;
+        }
+    }
+
+    for (DWORD nb = newFreeSyncTableIndex; nb < m_FreeSyncTableIndex; nb++)
+    {
+        _ASSERTE(pSyncTable[nb].m_SyncBlock == NULL);
+        pSyncTable[nb].m_Object = NULL;
+    }
+
+    m_FreeSyncTableList = freeSyncTableList;
+    m_FreeSyncTableIndex = newFreeSyncTableIndex;
+}
+
 /* Scan the weak pointers in the SyncBlockEntry and report them to the GC.  If the
    reference is dead, then return TRUE */
 
@@ -1596,15 +1645,17 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // From here on, spin as long as spinning has recently paid off for this particular lock
+            const DWORD awareLockSpinCount = awareLock->GetAdaptiveSpinCount();
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < awareLockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= awareLockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1613,6 +1664,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinOutcome(true);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1624,8 +1676,10 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->RecordSpinOutcome(true);
                 return AwareLock::EnterHelperResult_Entered;
             }
+            awareLock->RecordSpinOutcome(false);
             break;
         }
 
@@ -2639,7 +2693,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 bool acquiredLock = false;
                 YieldProcessorNormalizationInfo normalizationInfo;
-                const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
+                const DWORD spinCount = GetAdaptiveSpinCount();
                 for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
                 {
                     if (m_lockState.InterlockedTry_LockAndUnregisterWaiterAndObserveWakeSignal(this))
@@ -2650,6 +2704,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
                     SpinWait(normalizationInfo, spinIteration);
                 }
+                RecordSpinOutcome(acquiredLock);
                 if (acquiredLock)
                 {
                     break;
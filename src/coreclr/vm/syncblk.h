@@ -450,7 +450,12 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Number of spin iterations to use for this lock before waiting, learned from whether past spins acquired it
+    UINT16 m_spinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
+    static const UINT16 SpinCountNotInitialized = (UINT16)-1;
+    static const UINT16 MinAdaptiveSpinCount = 1;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
@@ -463,7 +468,8 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_spinCount(SpinCountNotInitialized)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -542,6 +548,9 @@ private: // friend access is required for this unsafe function
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
 
+    DWORD GetAdaptiveSpinCount() const;
+    void RecordSpinOutcome(bool acquired);
+
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
 
@@ -1345,6 +1354,7 @@ class SyncBlockCache
     BOOL CardSetP (size_t card);
     void CardTableSetBit (size_t idx);
     void Grow();
+    void TrimFreeSyncTableEntries();
 
 
   public:
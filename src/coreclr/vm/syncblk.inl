@@ -468,6 +468,38 @@ FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &norm
     YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
 }
 
+// Returns the number of spin iterations to use for this lock, which never exceeds the configured monitor spin count
+FORCEINLINE DWORD AwareLock::GetAdaptiveSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    UINT16 spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    return spinCount == SpinCountNotInitialized ? g_SpinConstants.dwMonitorSpinCount : min((DWORD)spinCount, g_SpinConstants.dwMonitorSpinCount);
+}
+
+// Spin longer on locks where spinning tends to acquire the lock, and shorter on locks where spinning tends to end in a
+// wait anyway. Updates are racy, which is fine since the count is only a heuristic.
+FORCEINLINE void AwareLock::RecordSpinOutcome(bool acquired)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD maxSpinCount = min(g_SpinConstants.dwMonitorSpinCount, (DWORD)(SpinCountNotInitialized - 1));
+    DWORD spinCount = GetAdaptiveSpinCount();
+    if (acquired)
+    {
+        if (spinCount < maxSpinCount)
+        {
+            spinCount++;
+        }
+    }
+    else if (spinCount > MinAdaptiveSpinCount)
+    {
+        spinCount--;
+    }
+
+    VolatileStoreWithoutBarrier(&m_spinCount, (UINT16)min(spinCount, maxSpinCount));
+}
+
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
 {
     CONTRACTL{
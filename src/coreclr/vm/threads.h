@@ -454,6 +454,12 @@ struct RuntimeThreadLocals
     // on MP systems, each thread has its own allocation chunk so we can avoid
     // lock prefixes and expensive MP cache snooping stuff
     gc_alloc_context alloc_context;
+
+#ifdef FEATURE_EVENT_TRACE
+    // Allocation sampling state, see code:ETW::TypeSystemLog::SampleObjectAllocationIfNecessary
+    int64_t alloc_sampling_threshold;
+    uint64_t alloc_sampling_random_state;
+#endif // FEATURE_EVENT_TRACE
 };
 
 #ifdef _MSC_VER
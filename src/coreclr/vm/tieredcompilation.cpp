@@ -40,6 +40,12 @@
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
 //
+// When TC_BackgroundWorkerCount is greater than one and a large backlog of methods
+// builds up (for instance at startup), the background worker also starts helper
+// workers. Helper workers only drain m_methodsToOptimize; they don't deal with the
+// tiering delay or call counting completion, and they exit as soon as the queue is
+// empty or the tiering delay is activated.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -58,6 +64,7 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREventStatic TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+UINT32 TieredCompilationManager::s_helperWorkerCount = 0;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
@@ -575,6 +582,158 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+// Minimum backlog of methods to optimize for each running worker before another helper worker is started
+#define TC_MinMethodsToOptimizePerWorker (16)
+
+bool TieredCompilationManager::TryReserveHelperWorker_Locked()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsLockOwnedByCurrentThread());
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    // The background worker itself accounts for one of the workers
+    UINT32 runningWorkerCount = s_helperWorkerCount + 1;
+    if (runningWorkerCount >= g_pConfig->TieredCompilation_BackgroundWorkerCount() ||
+        m_countOfMethodsToOptimize <= runningWorkerCount * TC_MinMethodsToOptimizePerWorker)
+    {
+        return false;
+    }
+
+    ++s_helperWorkerCount;
+    return true; // it's the caller's responsibility to call CreateHelperWorker() after releasing the lock
+}
+
+void TieredCompilationManager::CreateHelperWorker()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsLockOwnedByCurrentThread());
+
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartment(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, HelperWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Helper")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::CreateHelperWorker: "
+            "Exception creating helper worker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+
+        LockHolder tieredCompilationLockHolder;
+        _ASSERTE(s_helperWorkerCount != 0);
+        --s_helperWorkerCount;
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+DWORD WINAPI TieredCompilationManager::HelperWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        LockHolder tieredCompilationLockHolder;
+        _ASSERTE(s_helperWorkerCount != 0);
+        --s_helperWorkerCount;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(HelperWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::HelperWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->HelperWorkerStart();
+}
+
+void TieredCompilationManager::HelperWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() != s_backgroundWorkerThread);
+
+    while (true)
+    {
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            if (!IsTieringDelayActive())
+            {
+                nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+            }
+
+            if (nativeCodeVersionToOptimize.IsNull())
+            {
+                _ASSERTE(s_helperWorkerCount != 0);
+                --s_helperWorkerCount;
+                return;
+            }
+        }
+
+        OptimizeMethod(nativeCodeVersionToOptimize);
+
+        // Give preference to possibly more important work, similarly to the background worker
+        ClrSleepEx(0, false);
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -748,6 +907,7 @@ bool TieredCompilationManager::DoBackgroundWork(
     do
     {
         bool completeCallCounting = false;
+        bool createHelperWorker = false;
         NativeCodeVersion nativeCodeVersionToOptimize;
         {
             LockHolder tieredCompilationLockHolder;
@@ -796,9 +956,18 @@ bool TieredCompilationManager::DoBackgroundWork(
                         break;
                     }
                 }
+                else
+                {
+                    createHelperWorker = TryReserveHelperWorker_Locked();
+                }
             }
         }
 
+        if (createHelperWorker)
+        {
+            CreateHelperWorker();
+        }
+
         _ASSERTE(completeCallCounting == !!nativeCodeVersionToOptimize.IsNull());
         if (completeCallCounting)
         {
@@ -906,7 +1075,16 @@ bool TieredCompilationManager::DoBackgroundWork(
         ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(countOfMethodsToOptimize, jittedMethodCount);
     }
 
+    // Helper workers may still be finishing the last methods they dequeued, in which case leave the call counting stubs
+    // around for the next round of background work
+    bool helperWorkersRunning = false;
     if (allMethodsJitted)
+    {
+        LockHolder tieredCompilationLockHolder;
+        helperWorkersRunning = s_helperWorkerCount != 0;
+    }
+
+    if (allMethodsJitted && !helperWorkersRunning)
     {
         EX_TRY
         {
@@ -1073,7 +1251,14 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
 
         _ASSERT(!methodDesc->RequestedAggressiveOptimization());
 
-        if (g_pConfig->TieredCompilation_QuickJit())
+        bool startOptimized = !g_pConfig->TieredCompilation_QuickJit();
+    #ifdef FEATURE_PGO
+        // Methods with profile data saved by a previous run already reached the optimized tier there, go straight to it
+        // rather than paying for tier 0 and instrumented code a second time
+        startOptimized = startOptimized || PgoManager::ShouldStartOptimized(methodDesc);
+    #endif
+
+        if (!startOptimized)
         {
             NativeCodeVersion::OptimizationTier currentTier = nativeCodeVersion.GetOptimizationTier();
             if (currentTier == NativeCodeVersion::OptimizationTier::OptimizationTier0Instrumented)
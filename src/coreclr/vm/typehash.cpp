@@ -275,7 +275,7 @@ DWORD HashTypeKey(const TypeKey* pKey)
 // We avoid restoring types during search by cracking the signature
 // encoding used by the zapper for out-of-module types e.g. in the
 // instantiation of an instantiated type.
-EETypeHashEntry_t *EETypeHashTable::FindItem(const TypeKey* pKey)
+EETypeHashEntry_t *EETypeHashTable::FindItem(const TypeKey* pKey, DWORD dwHash)
 {
     CONTRACTL
     {
@@ -284,13 +284,13 @@ EETypeHashEntry_t *EETypeHashTable::FindItem(const TypeKey* pKey)
         GC_NOTRIGGER;
         MODE_ANY;
         PRECONDITION(CheckPointer(pKey));
+        PRECONDITION(dwHash == HashTypeKey(pKey));
         SUPPORTS_DAC;
     }
     CONTRACTL_END;
 
     EETypeHashEntry_t *  result = NULL;
 
-    DWORD           dwHash = HashTypeKey(pKey);
     EETypeHashEntry_t * pSearch;
     CorElementType kind = pKey->GetKind();
     LookupContext sContext;
@@ -469,7 +469,21 @@ TypeHandle EETypeHashTable::GetValue(const TypeKey *pKey)
     }
     CONTRACTL_END;
 
-    EETypeHashEntry_t *pItem = FindItem(pKey);
+    return GetValue(pKey, HashTypeKey(pKey));
+}
+
+TypeHandle EETypeHashTable::GetValue(const TypeKey *pKey, DWORD dwHash)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        SUPPORTS_DAC;
+    }
+    CONTRACTL_END;
+
+    EETypeHashEntry_t *pItem = FindItem(pKey, dwHash);
 
     if (pItem)
     {
@@ -497,6 +511,13 @@ BOOL EETypeHashTable::ContainsValue(TypeHandle th)
 
 // Insert a value not already in the hash table
 VOID EETypeHashTable::InsertValue(TypeHandle data)
+{
+    WRAPPER_NO_CONTRACT;
+
+    InsertValue(data, HashTypeHandle(data));
+}
+
+VOID EETypeHashTable::InsertValue(TypeHandle data, DWORD dwHash)
 {
     CONTRACTL
     {
@@ -505,6 +526,7 @@ VOID EETypeHashTable::InsertValue(TypeHandle data)
         GC_NOTRIGGER;
         MODE_ANY;
         INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(dwHash == HashTypeHandle(data));
         PRECONDITION(IsUnsealed());          // If we are sealed then we should not be adding to this hashtable
         PRECONDITION(CheckPointer(data));
         PRECONDITION(!data.IsGenericTypeDefinition()); // Generic type defs live in typedef table (availableClasses)
@@ -517,7 +539,7 @@ VOID EETypeHashTable::InsertValue(TypeHandle data)
 
     pNewEntry->SetTypeHandle(data);
 
-    BaseInsertEntry(HashTypeHandle(data), pNewEntry);
+    BaseInsertEntry(dwHash, pNewEntry);
 }
 
 #endif // #ifndef DACCESS_COMPILE
@@ -98,10 +98,16 @@ public:
     // Value must not be present in the table already
     VOID InsertValue(TypeHandle data);
 
+    // Same as above, with the hash of the key precomputed by HashTypeKey
+    VOID InsertValue(TypeHandle data, DWORD dwHash);
+
     // Look up a value in the hash table, key explicit in pKey
     // Return a null type handle if not found
     TypeHandle GetValue(const TypeKey* pKey);
 
+    // Same as above, with the hash of pKey precomputed by HashTypeKey
+    TypeHandle GetValue(const TypeKey* pKey, DWORD dwHash);
+
     BOOL ContainsValue(TypeHandle th);
 
     // An iterator for the table
@@ -134,7 +140,7 @@ public:
 #endif
 
 private:
-    EETypeHashEntry_t * FindItem(const TypeKey* pKey);
+    EETypeHashEntry_t * FindItem(const TypeKey* pKey, DWORD dwHash);
     BOOL CompareInstantiatedType(TypeHandle t, Module *pModule, mdTypeDef token, Instantiation inst);
     BOOL CompareFnPtrType(TypeHandle t, BYTE callConv, DWORD numArgs, TypeHandle *retAndArgTypes);
     BOOL GrowHashTable();
@@ -213,10 +213,10 @@ mono_loader_unlock_if_inited (void)
 static gpointer
 find_cached_memberref_sig (MonoImage *image, guint32 sig_idx)
 {
-	gpointer res;
+	gpointer res = NULL;
 
 	mono_image_lock (image);
-	res = g_hash_table_lookup (image->memberref_signatures, GUINT_TO_POINTER (sig_idx));
+	dn_simdhash_u32_ptr_try_get_value (image->memberref_signatures, sig_idx, &res);
 	mono_image_unlock (image);
 
 	return res;
@@ -225,18 +225,18 @@ find_cached_memberref_sig (MonoImage *image, guint32 sig_idx)
 static gpointer
 cache_memberref_sig (MonoImage *image, guint32 sig_idx, gpointer sig)
 {
-	gpointer prev_sig;
+	gpointer prev_sig = NULL;
 
 	mono_image_lock (image);
-	prev_sig = g_hash_table_lookup (image->memberref_signatures, GUINT_TO_POINTER (sig_idx));
+	dn_simdhash_u32_ptr_try_get_value (image->memberref_signatures, sig_idx, &prev_sig);
 	if (prev_sig) {
 		/* Somebody got in before us */
 		sig = prev_sig;
 	}
 	else {
-		g_hash_table_insert (image->memberref_signatures, GUINT_TO_POINTER (sig_idx), sig);
-		/* An approximation based on glib 2.18 */
-		mono_atomic_fetch_add_i32 (&memberref_sig_cache_size, sizeof (gpointer) * 4);
+		dn_simdhash_u32_ptr_try_add (image->memberref_signatures, sig_idx, sig);
+		/* An approximation of the per-entry cost of the table */
+		mono_atomic_fetch_add_i32 (&memberref_sig_cache_size, sizeof (guint32) + sizeof (gpointer));
 	}
 	mono_image_unlock (image);
 
@@ -1785,7 +1785,7 @@ mono_method_signature_checked_slow (MonoMethod *m, MonoError *error)
 	const char *sig;
 	gboolean can_cache_signature;
 	MonoGenericContainer *container;
-	MonoMethodSignature *signature = NULL, *sig2;
+	MonoMethodSignature *signature = NULL;
 	guint32 sig_offset;
 
 	/* We need memory barriers below because of the double-checked locking pattern */
@@ -1838,7 +1838,7 @@ mono_method_signature_checked_slow (MonoMethod *m, MonoError *error)
 
 	if (can_cache_signature) {
 		mono_image_lock (img);
-		signature = (MonoMethodSignature *)g_hash_table_lookup (img->method_signatures, sig);
+		dn_simdhash_ptr_ptr_try_get_value (img->method_signatures, (void *)sig, (void **)&signature);
 		mono_image_unlock (img);
 	}
 
@@ -1853,9 +1853,7 @@ mono_method_signature_checked_slow (MonoMethod *m, MonoError *error)
 
 		if (can_cache_signature) {
 			mono_image_lock (img);
-			sig2 = (MonoMethodSignature *)g_hash_table_lookup (img->method_signatures, sig);
-			if (!sig2)
-				g_hash_table_insert (img->method_signatures, (gpointer)sig, signature);
+			dn_simdhash_ptr_ptr_try_add (img->method_signatures, (void *)sig, signature);
 			mono_image_unlock (img);
 		}
 
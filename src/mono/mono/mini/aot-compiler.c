@@ -259,6 +259,7 @@ typedef struct MonoAotOptions {
 	gboolean use_current_cpu;
 	gboolean dump_json;
 	gboolean profile_only;
+	gboolean profile_order;
 	gboolean no_opt;
 	gboolean wrappers_only;
 	char *clangxx;
@@ -9063,6 +9064,8 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			opts->profile_files = g_list_append (opts->profile_files, g_strdup (arg + strlen ("profile=")));
 		} else if (!strcmp (arg, "profile-only")) {
 			opts->profile_only = TRUE;
+		} else if (!strcmp (arg, "profile-order")) {
+			opts->profile_order = TRUE;
 		} else if (str_begins_with (arg, "mibc-profile=")) {
 			opts->mibc_profile_files = g_list_append (opts->mibc_profile_files, g_strdup (arg + strlen ("mibc-profile=")));
 		} else if (!strcmp (arg, "verbose")) {
@@ -9160,6 +9163,7 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			printf ("    outfile=<string>                     - \n");
 			printf ("    profile=<string>                     - \n");
 			printf ("    profile-only                         - \n");
+			printf ("    profile-order                        - Emit methods found in the profile first, in the order they were recorded.\n");
 			printf ("    mibc-profile=<string>                - \n");
 			printf ("    print-skipped-methods                - \n");
 			printf ("    readonly-value=<value>               - \n");
@@ -10891,6 +10895,95 @@ compile_llvm_file (MonoAotCompile *acfg)
 }
 #endif
 
+typedef struct {
+	guint32 method_index;
+	guint32 order;
+	int rank;
+} MethodOrderEntry;
+
+static int
+compare_method_order_entries (gconstpointer a, gconstpointer b)
+{
+	const MethodOrderEntry *ea = (const MethodOrderEntry*)a;
+	const MethodOrderEntry *eb = (const MethodOrderEntry*)b;
+
+	if (ea->rank != eb->rank)
+		return ea->rank < eb->rank ? -1 : 1;
+	return ea->order < eb->order ? -1 : (ea->order > eb->order ? 1 : 0);
+}
+
+static int
+compare_method_profile_ids (gconstpointer a, gconstpointer b)
+{
+	int ida = (*(MethodProfileData**)a)->id;
+	int idb = (*(MethodProfileData**)b)->id;
+
+	return ida < idb ? -1 : (ida > idb ? 1 : 0);
+}
+
+/*
+ * sort_method_order_by_profile:
+ *
+ *   Move the methods recorded in the profile files to the front of METHOD_ORDER, in the
+ * order the profiler first saw them, so the code run at startup is packed into as few
+ * pages as possible. The remaining methods keep their relative order after them.
+ */
+static void
+sort_method_order_by_profile (MonoAotCompile *acfg)
+{
+	GHashTable *ranks = g_hash_table_new (NULL, NULL);
+	int nranked = 0;
+
+	for (GList *l = acfg->profile_data; l; l = l->next) {
+		ProfileData *data = (ProfileData*)l->data;
+		GHashTableIter iter;
+		gpointer key, value;
+		GPtrArray *mdatas = g_ptr_array_new ();
+
+		g_hash_table_iter_init (&iter, data->methods);
+		while (g_hash_table_iter_next (&iter, &key, &value)) {
+			MethodProfileData *mdata = (MethodProfileData*)value;
+			if (mdata->method)
+				g_ptr_array_add (mdatas, mdata);
+		}
+		mono_qsort (mdatas->pdata, mdatas->len, sizeof (gpointer), compare_method_profile_ids);
+
+		for (guint i = 0; i < mdatas->len; ++i) {
+			MonoMethod *m = ((MethodProfileData*)g_ptr_array_index (mdatas, i))->method;
+			if (!g_hash_table_lookup (ranks, m))
+				g_hash_table_insert (ranks, m, GINT_TO_POINTER (++nranked));
+		}
+		g_ptr_array_free (mdatas, TRUE);
+	}
+
+	if (nranked) {
+		guint len = acfg->method_order->len;
+		MethodOrderEntry *entries = g_new0 (MethodOrderEntry, len);
+		int nhot = 0;
+
+		for (guint oindex = 0; oindex < len; ++oindex) {
+			guint32 idx = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, oindex));
+			MonoCompile *cfg = acfg->cfgs [idx];
+			int rank = cfg ? GPOINTER_TO_INT (g_hash_table_lookup (ranks, cfg->orig_method)) : 0;
+
+			entries [oindex].method_index = idx;
+			entries [oindex].order = oindex;
+			entries [oindex].rank = rank ? rank : G_MAXINT;
+			if (rank)
+				nhot ++;
+		}
+		mono_qsort (entries, len, sizeof (MethodOrderEntry), compare_method_order_entries);
+
+		for (guint oindex = 0; oindex < len; ++oindex)
+			g_ptr_array_index (acfg->method_order, oindex) = GUINT_TO_POINTER (entries [oindex].method_index);
+		g_free (entries);
+
+		aot_printf (acfg, "Ordered %d methods from profile first.\n", nhot);
+	}
+
+	g_hash_table_destroy (ranks);
+}
+
 static void
 emit_code (MonoAotCompile *acfg)
 {
@@ -15569,6 +15662,9 @@ emit_aot_image (MonoAotCompile *acfg)
 	if (acfg->dwarf)
 		mono_dwarf_writer_emit_base_info (acfg->dwarf, g_path_get_basename (acfg->image->name), mono_unwind_get_cie_program ());
 
+	if (acfg->aot_opts.profile_order)
+		sort_method_order_by_profile (acfg);
+
 	emit_code (acfg);
 
 	emit_method_info_table (acfg);
@@ -3577,8 +3577,19 @@ interp_free_method (MonoMethod *method)
 
 #if COUNT_OPS
 static long opcode_counts[MINT_LASTOP];
-
-#define COUNT_OP(op) opcode_counts[op]++
+/*
+ * How often each opcode is directly followed by another, used to find candidates
+ * for new super instructions. Pairs spanning calls and returns are counted too.
+ */
+static long opcode_pair_counts[MINT_LASTOP][MINT_LASTOP];
+static int last_counted_op = -1;
+
+#define COUNT_OP(op) do { \
+		opcode_counts [op]++; \
+		if (last_counted_op >= 0) \
+			opcode_pair_counts [last_counted_op][op]++; \
+		last_counted_op = (op); \
+	} while (0)
 #else
 #define COUNT_OP(op)
 #endif
@@ -8629,6 +8640,56 @@ interp_print_op_count (void)
 		g_print ("%s : %ld (%.2lf%%)\n", mono_interp_opname (ordered_ops [i]), count, (double)count / total_ops * 100);
 	}
 }
+
+typedef struct {
+	guint16 first, second;
+	long count;
+} OpcodePairCount;
+
+static int
+opcode_pair_count_comparer (const void * pa, const void * pb)
+{
+	long counta = ((const OpcodePairCount*)pa)->count;
+	long countb = ((const OpcodePairCount*)pb)->count;
+
+	if (counta < countb)
+		return 1;
+	else if (counta > countb)
+		return -1;
+	else
+		return 0;
+}
+
+#define OPCODE_PAIR_PRINT_COUNT 100
+
+static void
+interp_print_op_pair_count (void)
+{
+	OpcodePairCount *pairs = g_new (OpcodePairCount, MINT_LASTOP * MINT_LASTOP);
+	int num_pairs = 0;
+	long total_pairs = 0;
+
+	for (int i = 0; i < MINT_LASTOP; i++) {
+		for (int j = 0; j < MINT_LASTOP; j++) {
+			long count = opcode_pair_counts [i][j];
+			if (!count)
+				continue;
+			pairs [num_pairs].first = (guint16)i;
+			pairs [num_pairs].second = (guint16)j;
+			pairs [num_pairs].count = count;
+			num_pairs++;
+			total_pairs += count;
+		}
+	}
+	qsort (pairs, num_pairs, sizeof (OpcodePairCount), opcode_pair_count_comparer);
+
+	g_print ("total op pairs %ld\n", total_pairs);
+	for (int i = 0; i < num_pairs && i < OPCODE_PAIR_PRINT_COUNT; i++) {
+		g_print ("%s -> %s : %ld (%.2lf%%)\n", mono_interp_opname (pairs [i].first), mono_interp_opname (pairs [i].second),
+			pairs [i].count, (double)pairs [i].count / total_pairs * 100);
+	}
+	g_free (pairs);
+}
 #endif
 
 #if PROFILE_INTERP
@@ -8831,6 +8892,7 @@ interp_cleanup (void)
 {
 #if COUNT_OPS
 	interp_print_op_count ();
+	interp_print_op_pair_count ();
 #endif
 #if PROFILE_INTERP
 	interp_print_method_counts ();
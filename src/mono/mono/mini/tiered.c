@@ -31,6 +31,16 @@ static const int threshold [NUM_TIERS] = {
 	3000, /* tier 1 */
 };
 
+static gboolean
+compilation_queue_has_work (void)
+{
+	for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++) {
+		if (compilation_queue [tier_level])
+			return TRUE;
+	}
+	return FALSE;
+}
+
 static void
 compiler_thread (void)
 {
@@ -40,8 +50,12 @@ compiler_thread (void)
 
 	mono_native_thread_set_name (mono_native_thread_id_get (), "Tiered Compilation Thread");
 
+	mono_coop_mutex_lock (&compilation_mutex);
+
 	while (TRUE) {
-		mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
+		/* Only sleep when there's nothing queued, so promotions signalled while we were patching aren't lost */
+		while (!compilation_queue_has_work ())
+			mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
 
 		for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++) {
 			GSList *ppcs = compilation_queue [tier_level];
@@ -54,9 +68,9 @@ compiler_thread (void)
 					if (!callsites_hash [patch_kind])
 						continue;
 
-					GSList *patchsites = g_hash_table_lookup (callsites_hash [patch_kind], ppc->target_method);
+					GSList *patchsites_head = (GSList *) g_hash_table_lookup (callsites_hash [patch_kind], ppc->target_method);
 
-					for (; patchsites != NULL; patchsites = patchsites->next) {
+					for (GSList *patchsites = patchsites_head; patchsites != NULL; patchsites = patchsites->next) {
 						gpointer patchsite = (gpointer) patchsites->data;
 
 						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: patching %p with patch_kind=%s @ tier_level=%d", patchsite, patch_kind_str [patch_kind], tier_level);
@@ -69,13 +83,12 @@ compiler_thread (void)
 							mono_trace (G_LOG_LEVEL_WARNING, MONO_TRACE_TIERED, "tiered: couldn't patch %p with target %s, dropping it.", patchsite, mono_method_full_name (ppc->target_method, TRUE));
 					}
 					g_hash_table_remove (callsites_hash [patch_kind], ppc->target_method);
-					g_slist_free (patchsites);
+					g_slist_free (patchsites_head);
 				}
 				g_free (ppc);
 			}
 			g_slist_free (ppcs);
 		}
-		mono_coop_mutex_unlock (&compilation_mutex);
 	}
 }
 
@@ -52,6 +52,9 @@
 
 #define LOS_NUM_FAST_SIZES		32
 
+/* Number of empty sections kept mapped after a sweep instead of being returned to the OS. */
+#define LOS_MAX_CACHED_SECTIONS		4
+
 typedef struct _LOSFreeChunks LOSFreeChunks;
 struct _LOSFreeChunks {
 	LOSFreeChunks *next_size;
@@ -129,6 +132,9 @@ static LOSSection *los_sections = NULL;
 static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES]; /* 0 is for larger sizes */
 static mword los_num_objects = 0;
 static int los_num_sections = 0;
+/* Empty sections retained by los_sweep () for reuse, linked through their next field. */
+static LOSSection *los_cached_sections = NULL;
+static int los_num_cached_sections = 0;
 
 //#define USE_MALLOC
 //#define LOS_CONSISTENCY_CHECK
@@ -314,7 +320,13 @@ get_los_section_memory (size_t size)
 			return NULL;
 	}
 
-	section = (LOSSection *)sgen_alloc_os_memory_aligned (LOS_SECTION_SIZE, LOS_SECTION_SIZE, (SgenAllocFlags)(SGEN_ALLOC_HEAP | SGEN_ALLOC_ACTIVATE), NULL, MONO_MEM_ACCOUNT_SGEN_LOS);
+	if (los_cached_sections) {
+		section = los_cached_sections;
+		los_cached_sections = section->next;
+		--los_num_cached_sections;
+	} else {
+		section = (LOSSection *)sgen_alloc_os_memory_aligned (LOS_SECTION_SIZE, LOS_SECTION_SIZE, (SgenAllocFlags)(SGEN_ALLOC_HEAP | SGEN_ALLOC_ACTIVATE), NULL, MONO_MEM_ACCOUNT_SGEN_LOS);
+	}
 
 	if (!section)
 		return NULL;
@@ -538,7 +550,18 @@ sgen_los_sweep (void)
 				prev->next = next;
 			else
 				los_sections = next;
-			sgen_free_os_memory (section, LOS_SECTION_SIZE, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
+			/*
+			 * Keep a few empty sections around so that programs that keep
+			 * allocating and dropping large objects don't map and unmap a
+			 * section on every collection.
+			 */
+			if (los_num_cached_sections < LOS_MAX_CACHED_SECTIONS) {
+				section->next = los_cached_sections;
+				los_cached_sections = section;
+				++los_num_cached_sections;
+			} else {
+				sgen_free_os_memory (section, LOS_SECTION_SIZE, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
+			}
 			sgen_memgov_release_space (LOS_SECTION_SIZE, SPACE_LOS);
 			section = next;
 			--los_num_sections;
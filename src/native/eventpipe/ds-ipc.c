@@ -362,6 +362,7 @@ ds_ipc_stream_factory_get_next_available_stream (ds_ipc_error_callback_func call
 	DiagnosticsIpcStream *stream = NULL;
 
 	uint32_t poll_timeout_ms = DS_IPC_TIMEOUT_INFINITE;
+	uint32_t hangup_backoff_ms = DS_IPC_TIMEOUT_INFINITE;
 	bool connect_success = true;
 	uint32_t poll_attempts = 0;
 
@@ -400,6 +401,7 @@ ds_ipc_stream_factory_get_next_available_stream (ds_ipc_error_callback_func call
 		}
 
 		bool saw_error = false;
+		bool saw_hangup = false;
 
 		if (ret_val != 0) {
 			uint32_t connection_id = 0;
@@ -411,6 +413,7 @@ ds_ipc_stream_factory_get_next_available_stream (ds_ipc_error_callback_func call
 					ds_port_reset_vcall (port, callback);
 					DS_LOG_INFO_2 ("ds_ipc_stream_factory_get_next_available_stream - HUP :: Poll attempt: %d, connection %d hung up. Connect is reset.", poll_attempts, connection_id);
 					poll_timeout_ms = DS_IPC_POLL_TIMEOUT_MIN_MS;
+					saw_hangup = true;
 					break;
 				case DS_IPC_POLL_EVENTS_SIGNALED:
 					EP_ASSERT (port != NULL);
@@ -452,6 +455,15 @@ ds_ipc_stream_factory_get_next_available_stream (ds_ipc_error_callback_func call
 			ep_raise_error ();
 		}
 
+		if (!stream && saw_hangup) {
+			// A reverse connection that is accepted and then immediately hung up reconnects successfully
+			// on the next iteration, so poll would return instantly again. Back off between consecutive
+			// hangups to avoid spinning on a flaky port.
+			hangup_backoff_ms = ipc_stream_factory_get_next_timeout (hangup_backoff_ms);
+			DS_LOG_DEBUG_1 ("ds_ipc_stream_factory_get_next_available_stream - Saw hangup, sleeping using timeout: %dms.", hangup_backoff_ms);
+			ep_rt_thread_sleep ((uint64_t)hangup_backoff_ms * NUM_NANOSECONDS_IN_1_MS);
+		}
+
 		// clear the view.
 		dn_vector_clear (&ipc_poll_handles);
 	}
@@ -18,6 +18,10 @@
 #define EP_MIN(a,b) (((a) < (b)) ? (a) : (b))
 #define EP_CLAMP(min,value,max) (EP_MIN(EP_MAX(min, value), max))
 
+// Upper bound (in 1 msec sleeps) a lossless writer waits for buffer space before dropping the event.
+// After the first timeout the thread goes back to lossy writes, so the total stall is bounded too.
+#define EP_BUFFER_MANAGER_LOSSLESS_WRITE_MAX_RETRIES 1000
+
 /*
  * Forward declares of all static functions.
  */
@@ -728,11 +732,14 @@ buffer_manager_advance_to_non_empty_buffer (
 			// found a non-empty buffer
 			done = true;
 		} else {
+			EventPipeBuffer *removed_buffer = NULL;
 			EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
-				// delete the empty buffer
-				EventPipeBuffer *removed_buffer = ep_buffer_list_get_and_remove_head (buffer_list);
+				// unlink the empty buffer
+				removed_buffer = ep_buffer_list_get_and_remove_head (buffer_list);
 				EP_ASSERT (current_buffer == removed_buffer);
-				buffer_manager_deallocate_buffer (buffer_manager, removed_buffer);
+#ifdef EP_CHECKED_BUILD
+				buffer_manager->num_buffers_allocated--;
+#endif
 
 				// get the next buffer
 				current_buffer = buffer_list->head_buffer;
@@ -742,6 +749,13 @@ buffer_manager_advance_to_non_empty_buffer (
 					done = true;
 				}
 			EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+
+			// Free the unlinked buffer outside of the lock so that writer threads allocating
+			// new buffers don't wait on releasing its memory.
+			if (removed_buffer) {
+				buffer_manager_release_buffer (buffer_manager, ep_buffer_get_size (removed_buffer));
+				ep_buffer_free (removed_buffer);
+			}
 		}
 	}
 
@@ -999,6 +1013,26 @@ ep_buffer_manager_write_event (
 		uint32_t request_size = sizeof (EventPipeEventInstance) + ep_event_payload_get_size (payload);
 		bool write_suspended = false;
 		buffer = buffer_manager_allocate_buffer_for_thread (buffer_manager, session_state, request_size, &write_suspended);
+
+		// Threads that opted into lossless writes (e.g. a heap dump, where a dropped event
+		// corrupts the whole snapshot) wait for the streaming thread to drain buffers instead
+		// of dropping the event. The wait is bounded so a stalled reader can't hang the writer.
+		if (!buffer && !write_suspended && ep_thread_get_lossless_writes (current_thread) && ep_session_get_streaming_enabled (session)) {
+			const uint32_t retry_sleep_ns = 1000000; // 1 msec.
+			for (uint32_t retry = 0; !buffer && !write_suspended && retry < EP_BUFFER_MANAGER_LOSSLESS_WRITE_MAX_RETRIES; ++retry) {
+				ep_rt_wait_event_set (&buffer_manager->rt_wait_event);
+				ep_rt_thread_sleep (retry_sleep_ns);
+				if (!ep_session_get_streaming_enabled (session))
+					break;
+				buffer = buffer_manager_allocate_buffer_for_thread (buffer_manager, session_state, request_size, &write_suspended);
+			}
+
+			// The reader isn't keeping up. The writer may be holding up the whole process (a heap
+			// walk runs with the EE suspended), so stop waiting for the rest of its events.
+			if (!buffer)
+				ep_thread_set_lossless_writes (current_thread, 0);
+		}
+
 		if (!buffer) {
 			// We treat this as the write_event call occurring after this session stopped listening for events, effectively the
 			// same as if ep_event_is_enabled test above returned false.
@@ -174,6 +174,7 @@ ep_fast_serializer_alloc (StreamWriter *stream_writer)
 	instance->stream_writer = stream_writer;
 	instance->required_padding = 0;
 	instance->write_error_encountered = false;
+	instance->pending_len = 0;
 
 	ep_fast_serializer_write_string (instance, signature, signature_len);
 
@@ -192,13 +193,15 @@ ep_fast_serializer_free (FastSerializer *fast_serializer)
 	ep_return_void_if_nok (fast_serializer != NULL);
 
 	EP_ASSERT (fast_serializer->stream_writer != NULL);
+	ep_fast_serializer_flush (fast_serializer);
 	ep_stream_writer_free_vcall (fast_serializer->stream_writer);
 
 	ep_rt_object_free (fast_serializer);
 }
 
+static
 void
-ep_fast_serializer_write_buffer (
+fast_serializer_write_to_stream (
 	FastSerializer *fast_serializer,
 	const uint8_t *buffer,
 	uint32_t buffer_len)
@@ -207,21 +210,58 @@ ep_fast_serializer_write_buffer (
 	EP_ASSERT (buffer != NULL);
 	EP_ASSERT (buffer_len > 0);
 
-	ep_return_void_if_nok (!fast_serializer->write_error_encountered && fast_serializer->stream_writer != NULL);
-
 	uint32_t bytes_written = 0;
 	bool result = ep_stream_writer_write (fast_serializer->stream_writer, buffer, buffer_len, &bytes_written);
 
-	uint32_t required_padding = fast_serializer->required_padding;
-	required_padding = (FAST_SERIALIZER_ALIGNMENT_SIZE + required_padding - (bytes_written % FAST_SERIALIZER_ALIGNMENT_SIZE)) % FAST_SERIALIZER_ALIGNMENT_SIZE;
-	fast_serializer->required_padding = required_padding;
-
 	// This will cause us to stop writing to the file.
 	// The file will still remain open until shutdown so that we don't
 	// have to take a lock at this level when we touch the file stream.
 	fast_serializer->write_error_encountered = ((buffer_len != bytes_written) || !result);
 }
 
+void
+ep_fast_serializer_write_buffer (
+	FastSerializer *fast_serializer,
+	const uint8_t *buffer,
+	uint32_t buffer_len)
+{
+	EP_ASSERT (fast_serializer != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len > 0);
+
+	ep_return_void_if_nok (!fast_serializer->write_error_encountered && fast_serializer->stream_writer != NULL);
+
+	if (buffer_len > FAST_SERIALIZER_PENDING_BUFFER_SIZE - fast_serializer->pending_len) {
+		ep_fast_serializer_flush (fast_serializer);
+		ep_return_void_if_nok (!fast_serializer->write_error_encountered);
+	}
+
+	if (buffer_len <= FAST_SERIALIZER_PENDING_BUFFER_SIZE - fast_serializer->pending_len) {
+		memcpy (fast_serializer->pending + fast_serializer->pending_len, buffer, buffer_len);
+		fast_serializer->pending_len += buffer_len;
+	} else {
+		fast_serializer_write_to_stream (fast_serializer, buffer, buffer_len);
+	}
+
+	// Padding is tracked against the logical stream position; a failed write stops all further output.
+	uint32_t required_padding = fast_serializer->required_padding;
+	required_padding = (FAST_SERIALIZER_ALIGNMENT_SIZE + required_padding - (buffer_len % FAST_SERIALIZER_ALIGNMENT_SIZE)) % FAST_SERIALIZER_ALIGNMENT_SIZE;
+	fast_serializer->required_padding = required_padding;
+}
+
+void
+ep_fast_serializer_flush (FastSerializer *fast_serializer)
+{
+	EP_ASSERT (fast_serializer != NULL);
+
+	uint32_t pending_len = fast_serializer->pending_len;
+	fast_serializer->pending_len = 0;
+
+	ep_return_void_if_nok (pending_len != 0 && !fast_serializer->write_error_encountered && fast_serializer->stream_writer != NULL);
+
+	fast_serializer_write_to_stream (fast_serializer, fast_serializer->pending, pending_len);
+}
+
 void
 ep_fast_serializer_write_system_time (
 	FastSerializer *fast_serializer,
@@ -260,6 +300,9 @@ ep_fast_serializer_write_object (
 	ep_fast_serializable_object_fast_serialize_vcall (fast_serializable_object, fast_serializer);
 
 	ep_fast_serializer_write_tag (fast_serializer, FAST_SERIALIZER_TAGS_END_OBJECT, NULL, 0);
+
+	// Objects are the unit the reader consumes, so push any coalesced bytes out to the stream.
+	ep_fast_serializer_flush (fast_serializer);
 }
 
 void
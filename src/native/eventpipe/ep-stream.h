@@ -155,6 +155,10 @@ ep_fast_serializable_object_fast_serialize_vcall (
 
 #define FAST_SERIALIZER_ALIGNMENT_SIZE 4
 
+// Small writes (tags, header fields, strings) are coalesced into a buffer of this size so
+// that serializing an object doesn't issue one stream write per field.
+#define FAST_SERIALIZER_PENDING_BUFFER_SIZE 256
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_STREAM_GETTER_SETTER)
 struct _FastSerializer {
 #else
@@ -163,6 +167,8 @@ struct _FastSerializer_Internal {
 	StreamWriter *stream_writer;
 	uint32_t required_padding;
 	bool write_error_encountered;
+	uint32_t pending_len;
+	uint8_t pending [FAST_SERIALIZER_PENDING_BUFFER_SIZE];
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_STREAM_GETTER_SETTER)
@@ -187,6 +193,9 @@ ep_fast_serializer_write_buffer (
 	const uint8_t *buffer,
 	uint32_t buffer_len);
 
+void
+ep_fast_serializer_flush (FastSerializer *fast_serializer);
+
 #define EP_FAST_SERIALIZER_WRITE_INT(BITS, SIGNEDNESS) \
 static \
 inline \
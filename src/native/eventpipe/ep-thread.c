@@ -39,6 +39,7 @@ ep_thread_alloc (void)
 
 	instance->writing_event_in_progress = UINT32_MAX;
 	instance->unregistered = 0;
+	instance->lossless_writes = 0;
 
 ep_on_exit:
 	return instance;
@@ -50,6 +50,11 @@ struct _EventPipeThread_Internal {
 	// This is a convenience marker to prevent us from having to search the global list.
 	// defaults to false.
 	volatile uint32_t unregistered;
+	// When non-zero, writes from this thread to a streaming session block (for a bounded
+	// amount of time) waiting for the streaming thread to free buffer space instead of
+	// dropping the event. Cleared again after the first wait that times out. Only
+	// read/written by the owning thread.
+	uint32_t lossless_writes;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_THREAD_GETTER_SETTER)
@@ -76,6 +81,8 @@ EP_DEFINE_GETTER_REF(EventPipeThread *, thread, ep_rt_spin_lock_handle_t *, rt_l
 EP_DEFINE_GETTER(EventPipeThread *, thread, uint64_t, os_thread_id);
 EP_DEFINE_GETTER_REF(EventPipeThread *, thread, int32_t *, ref_count);
 EP_DEFINE_GETTER_REF(EventPipeThread *, thread, volatile uint32_t *, unregistered);
+EP_DEFINE_GETTER(EventPipeThread *, thread, uint32_t, lossless_writes);
+EP_DEFINE_SETTER(EventPipeThread *, thread, uint32_t, lossless_writes);
 
 EventPipeThread *
 ep_thread_alloc (void);
@@ -1263,6 +1263,17 @@ ep_enabled (void)
 			ep_volatile_load_number_of_sessions () > 0);
 }
 
+bool
+ep_set_lossless_writes_for_current_thread (bool lossless)
+{
+	EventPipeThread *const thread = ep_thread_get_or_create ();
+	ep_return_false_if_nok (thread != NULL);
+
+	bool previous = ep_thread_get_lossless_writes (thread) != 0;
+	ep_thread_set_lossless_writes (thread, lossless ? 1 : 0);
+	return previous;
+}
+
 EventPipeProvider *
 ep_create_provider (
 	const ep_char8_t *provider_name,
@@ -207,6 +207,11 @@ ep_start_streaming (EventPipeSessionID session_id);
 bool
 ep_enabled (void);
 
+// Makes writes from the calling thread to streaming sessions wait for buffer
+// space rather than drop events. Returns the previous setting.
+bool
+ep_set_lossless_writes_for_current_thread (bool lossless);
+
 EventPipeProvider *
 ep_create_provider (
 	const ep_char8_t *provider_name,
@@ -15,6 +15,28 @@
 #pragma clang diagnostic ignored "-Wsign-conversion"
 #endif
 
+// ASCII code points case the same way in every casing mode handled here (the Turkish i's are
+// special cased by the callers before reaching these), so map them without calling into ICU.
+static inline UChar32 ToUpper(UChar32 codepoint)
+{
+    if (codepoint < 0x80)
+    {
+        return (codepoint >= 'a' && codepoint <= 'z') ? codepoint - 0x20 : codepoint;
+    }
+
+    return u_toupper(codepoint);
+}
+
+static inline UChar32 ToLower(UChar32 codepoint)
+{
+    if (codepoint < 0x80)
+    {
+        return (codepoint >= 'A' && codepoint <= 'Z') ? codepoint + 0x20 : codepoint;
+    }
+
+    return u_tolower(codepoint);
+}
+
 /*
 Function:
 ChangeCase
@@ -45,7 +67,7 @@ void GlobalizationNative_ChangeCase(
         while (srcIdx < cwSrcLength)
         {
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
-            dstCodepoint = u_toupper(srcCodepoint);
+            dstCodepoint = ToUpper(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
             assert(isError == false && srcIdx == dstIdx);
         }
@@ -55,7 +77,7 @@ void GlobalizationNative_ChangeCase(
         while (srcIdx < cwSrcLength)
         {
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
-            dstCodepoint = u_tolower(srcCodepoint);
+            dstCodepoint = ToLower(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
             assert(isError == false && srcIdx == dstIdx);
         }
@@ -88,7 +110,7 @@ void GlobalizationNative_ChangeCaseInvariant(
             // capitalizes to itself, whereas with ICU it capitalizes to LATIN CAPITAL LETTER I (U+0049).
             // We special case it to match the Windows invariant behavior.
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
-            dstCodepoint = ((srcCodepoint == (UChar32)0x0131) ? (UChar32)0x0131 : u_toupper(srcCodepoint));
+            dstCodepoint = ((srcCodepoint == (UChar32)0x0131) ? (UChar32)0x0131 : ToUpper(srcCodepoint));
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
             assert(isError == false && srcIdx == dstIdx);
         }
@@ -101,7 +123,7 @@ void GlobalizationNative_ChangeCaseInvariant(
             // lower cases to itself, whereas with ICU it lower cases to LATIN SMALL LETTER I (U+0069).
             // We special case it to match the Windows invariant behavior.
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
-            dstCodepoint = ((srcCodepoint == (UChar32)0x0130) ? (UChar32)0x0130 : u_tolower(srcCodepoint));
+            dstCodepoint = ((srcCodepoint == (UChar32)0x0130) ? (UChar32)0x0130 : ToLower(srcCodepoint));
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
             assert(isError == false && srcIdx == dstIdx);
         }
@@ -132,7 +154,7 @@ void GlobalizationNative_ChangeCaseTurkish(
             // In turkish casing, LATIN SMALL LETTER I (U+0069) upper cases to LATIN
             // CAPITAL LETTER I WITH DOT ABOVE (U+0130).
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
-            dstCodepoint = ((srcCodepoint == (UChar32)0x0069) ? (UChar32)0x0130 : u_toupper(srcCodepoint));
+            dstCodepoint = ((srcCodepoint == (UChar32)0x0069) ? (UChar32)0x0130 : ToUpper(srcCodepoint));
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
             assert(isError == false && srcIdx == dstIdx);
         }
@@ -144,7 +166,7 @@ void GlobalizationNative_ChangeCaseTurkish(
             // In turkish casing, LATIN CAPITAL LETTER I (U+0049) lower cases to
             // LATIN SMALL LETTER DOTLESS I (U+0131).
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
-            dstCodepoint = ((srcCodepoint == (UChar32)0x0049) ? (UChar32)0x0131 : u_tolower(srcCodepoint));
+            dstCodepoint = ((srcCodepoint == (UChar32)0x0049) ? (UChar32)0x0131 : ToLower(srcCodepoint));
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
             assert(isError == false && srcIdx == dstIdx);
         }
@@ -24,12 +24,16 @@ static const Entry s_compressionNative[] =
     DllImportEntry(BrotliEncoderHasMoreOutput)
     DllImportEntry(BrotliEncoderSetParameter)
     DllImportEntry(CompressionNative_Crc32)
+    DllImportEntry(CompressionNative_Crc32Segments)
     DllImportEntry(CompressionNative_Deflate)
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateInit2_)
+    DllImportEntry(CompressionNative_DeflateReset)
+    DllImportEntry(CompressionNative_DeflateSegments)
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateInit2_)
+    DllImportEntry(CompressionNative_InflateReset)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
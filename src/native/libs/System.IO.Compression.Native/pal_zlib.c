@@ -138,6 +138,64 @@ int32_t CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush)
     return result;
 }
 
+int32_t CompressionNative_DeflateSegments(
+    PAL_ZStream* stream, PAL_ZSegment* segments, int32_t segmentCount, int32_t flush, int32_t* segmentsConsumed)
+{
+    assert(stream != NULL);
+    assert(segments != NULL || segmentCount == 0);
+    assert(segmentCount >= 0);
+    assert(segmentsConsumed != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = PAL_Z_OK;
+    int32_t consumed = 0;
+
+    while (consumed < segmentCount)
+    {
+        int32_t segmentFlush = consumed == segmentCount - 1 ? flush : Z_NO_FLUSH;
+
+        // Without input or a flush to make progress on, deflate would fail with Z_BUF_ERROR.
+        if (segments[consumed].length == 0 && segmentFlush == Z_NO_FLUSH)
+        {
+            consumed++;
+            continue;
+        }
+
+        // The same goes for a full output buffer; the caller resumes from this segment.
+        if (zStream->avail_out == 0)
+        {
+            break;
+        }
+
+        zStream->next_in = segments[consumed].buffer;
+        zStream->avail_in = segments[consumed].length;
+
+        result = deflate(zStream, segmentFlush);
+        if (result < 0 || zStream->avail_in != 0)
+        {
+            break;
+        }
+
+        consumed++;
+    }
+
+    TransferStateToPalZStream(zStream, stream);
+    *segmentsConsumed = consumed;
+
+    return result;
+}
+
+int32_t CompressionNative_DeflateReset(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateReset(zStream);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream)
 {
     assert(stream != NULL);
@@ -175,6 +233,17 @@ int32_t CompressionNative_Inflate(PAL_ZStream* stream, int32_t flush)
     return result;
 }
 
+int32_t CompressionNative_InflateReset(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = inflateReset(zStream);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_InflateEnd(PAL_ZStream* stream)
 {
     assert(stream != NULL);
@@ -194,3 +263,18 @@ uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
     assert(result <= UINT32_MAX);
     return (uint32_t)result;
 }
+
+uint32_t CompressionNative_Crc32Segments(uint32_t crc, PAL_ZSegment* segments, int32_t segmentCount)
+{
+    assert(segments != NULL || segmentCount == 0);
+
+    unsigned long result = crc;
+    for (int32_t i = 0; i < segmentCount; i++)
+    {
+        assert(segments[i].buffer != NULL || segments[i].length == 0);
+        result = crc32(result, segments[i].buffer, segments[i].length);
+    }
+
+    assert(result <= UINT32_MAX);
+    return (uint32_t)result;
+}
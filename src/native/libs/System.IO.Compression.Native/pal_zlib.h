@@ -30,6 +30,15 @@ typedef struct PAL_ZStream
     uint32_t availOut; // remaining free space at nextOut
 } PAL_ZStream;
 
+/*
+A contiguous input buffer for the functions that process several segments per call.
+*/
+typedef struct PAL_ZSegment
+{
+    uint8_t* buffer;
+    uint32_t length;
+} PAL_ZSegment;
+
 /*
 Allowed flush values for the Deflate and Inflate functions.
 */
@@ -95,6 +104,26 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush);
 
+/*
+Deflates (compresses) each of the input segments in order into the PAL_ZStream's nextOut
+buffer, applying flush only to the last segment. Empty segments are skipped. Processing stops
+early when the output buffer fills up or an error occurs; nextIn/availIn then describe the
+unconsumed remainder of the current segment, and segmentsConsumed receives the number of
+segments fully consumed.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateSegments(
+    PAL_ZStream* stream, PAL_ZSegment* segments, int32_t segmentCount, int32_t flush, int32_t* segmentsConsumed);
+
+/*
+Resets an initialized deflate PAL_ZStream so it can compress a new stream with the same
+parameters, keeping its allocated state instead of ending and re-initializing it.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateReset(PAL_ZStream* stream);
+
 /*
 All dynamically allocated data structures for this stream are freed.
 
@@ -117,6 +146,14 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Inflate(PAL_ZStream* stream, int32_t flush);
 
+/*
+Resets an initialized inflate PAL_ZStream so it can decompress a new stream with the same
+parameters, keeping its allocated state instead of ending and re-initializing it.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_InflateReset(PAL_ZStream* stream);
+
 /*
 All dynamically allocated data structures for this stream are freed.
 
@@ -131,3 +168,11 @@ updated CRC-32.
 Returns the updated CRC-32.
 */
 FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len);
+
+/*
+Update a running CRC-32 with the bytes of each of the segments in order and return the
+updated CRC-32.
+
+Returns the updated CRC-32.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Crc32Segments(uint32_t crc, PAL_ZSegment* segments, int32_t segmentCount);
@@ -150,6 +150,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetIPv6Address)
     DllImportEntry(SystemNative_GetControlMessageBufferSize)
     DllImportEntry(SystemNative_TryGetIPPacketInformation)
+    DllImportEntry(SystemNative_TryGetUdpGroSegmentSize)
     DllImportEntry(SystemNative_GetIPv4MulticastOption)
     DllImportEntry(SystemNative_SetIPv4MulticastOption)
     DllImportEntry(SystemNative_GetIPv6MulticastOption)
@@ -161,8 +162,11 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_Receive)
     DllImportEntry(SystemNative_ReceiveMessage)
     DllImportEntry(SystemNative_ReceiveSocketError)
+    DllImportEntry(SystemNative_ReceiveZeroCopyCompletion)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
+    DllImportEntry(SystemNative_SendMessages)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -185,7 +189,9 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_CreateSocketEventBuffer)
     DllImportEntry(SystemNative_FreeSocketEventBuffer)
     DllImportEntry(SystemNative_TryChangeSocketEventRegistration)
+    DllImportEntry(SystemNative_TryChangeSocketEventRegistrations)
     DllImportEntry(SystemNative_WaitForSocketEvents)
+    DllImportEntry(SystemNative_WaitForSocketEventsWithTimeout)
     DllImportEntry(SystemNative_PlatformSupportsDualModeIPv4PacketInfo)
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
@@ -66,6 +66,9 @@
 #include <linux/errqueue.h>
 #include <linux/icmp.h>
 #endif
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
 
 
 #if HAVE_KQUEUE
@@ -1056,6 +1059,33 @@ SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isI
     return 0;
 }
 
+int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize)
+{
+    if (messageHeader == NULL || segmentSize == NULL)
+    {
+        return 0;
+    }
+
+#if defined(UDP_GRO)
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (controlMessage->cmsg_level == IPPROTO_UDP && controlMessage->cmsg_type == UDP_GRO)
+        {
+            int value;
+            memcpy(&value, CMSG_DATA(controlMessage), sizeof(value));
+            *segmentSize = value;
+            return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
 static int8_t GetMulticastOptionName(int32_t multicastOption, int8_t isIPv6, int* optionName)
 {
     switch (multicastOption)
@@ -1333,6 +1363,9 @@ static int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFla
     const int32_t SupportedFlagsMask =
 #ifdef MSG_ERRQUEUE
                         SocketFlags_MSG_ERRQUEUE |
+#endif
+#ifdef MSG_ZEROCOPY
+                        SocketFlags_MSG_ZEROCOPY |
 #endif
                         SocketFlags_MSG_OOB | SocketFlags_MSG_PEEK | SocketFlags_MSG_DONTROUTE | SocketFlags_MSG_TRUNC | SocketFlags_MSG_CTRUNC | SocketFlags_MSG_DONTWAIT;
 
@@ -1352,6 +1385,12 @@ static int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFla
     {
         *platformFlags |= MSG_ERRQUEUE;
     }
+#endif
+#ifdef MSG_ZEROCOPY
+    if ((palFlags & SocketFlags_MSG_ZEROCOPY) != 0)
+    {
+        *platformFlags |= MSG_ZEROCOPY;
+    }
 #endif
     return true;
 }
@@ -1450,6 +1489,80 @@ int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageH
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* rangeStart, uint32_t* rangeEnd, int32_t* copied)
+{
+    if (rangeStart == NULL || rangeEnd == NULL || copied == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+#if HAVE_LINUX_ERRQUEUE_H && defined(SO_EE_ORIGIN_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    int fd = ToFileDescriptor(socket);
+
+    // Completions carry no payload; for TCP the kernel coalesces consecutive sends into one
+    // notification covering the range of send sequence numbers [ee_info, ee_data].
+    char buffer[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_storage))];
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    header.msg_control = buffer;
+    header.msg_controllen = sizeof(buffer);
+
+    // The error queue can't be peeked (MSG_PEEK is ignored with MSG_ERRQUEUE), so this
+    // dequeues whatever error is at its head, which may not be a completion.
+    ssize_t res;
+    while ((res = recvmsg(fd, &header, MSG_DONTWAIT | MSG_ERRQUEUE)) < 0 && errno == EINTR);
+
+    if (res == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    int32_t queuedError = Error_ENOMSG;
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != NULL; cmsg = GET_CMSG_NXTHDR(&header, cmsg))
+    {
+        if ((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+            (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR))
+        {
+            struct sock_extended_err* e = (struct sock_extended_err*)CMSG_DATA(cmsg);
+            if (e->ee_origin == SO_EE_ORIGIN_ZEROCOPY && e->ee_errno == 0)
+            {
+                *rangeStart = e->ee_info;
+                *rangeEnd = e->ee_data;
+                // The kernel fell back to copying; callers may stop requesting zero-copy for this socket.
+                *copied = (e->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+                return Error_SUCCESS;
+            }
+
+            if (e->ee_errno != 0)
+            {
+                queuedError = SystemNative_ConvertErrorPlatformToPal((int32_t)e->ee_errno);
+            }
+        }
+    }
+
+    // Some other error was queued (e.g. ICMP). It is no longer on the queue, so return it
+    // instead of a completion rather than losing it.
+    return queuedError;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+static void UpdateMessageHeaderFromMsghdr(MessageHeader* messageHeader, const struct msghdr* header)
+{
+    assert(header->msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
+    assert(header->msg_control == messageHeader->ControlBuffer);
+
+    assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+    messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+    assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+    messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+}
+
 int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* received)
 {
     if (messageHeader == NULL || received == NULL || messageHeader->SocketAddressLen < 0 ||
@@ -1472,16 +1585,7 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     ssize_t res;
     while ((res = recvmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
 
-    assert(header.msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
-    assert(header.msg_control == messageHeader->ControlBuffer);
-
-    assert((int32_t)header.msg_namelen <= messageHeader->SocketAddressLen);
-    messageHeader->SocketAddressLen = Min((int32_t)header.msg_namelen, messageHeader->SocketAddressLen);
-
-    assert(header.msg_controllen <= (size_t)messageHeader->ControlBufferLen);
-    messageHeader->ControlBufferLen = Min((int32_t)header.msg_controllen, messageHeader->ControlBufferLen);
-
-    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header.msg_flags);
+    UpdateMessageHeaderFromMsghdr(messageHeader, &header);
 
     if (res != -1)
     {
@@ -1567,6 +1671,164 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// Upper bound on the number of messages handled by one ReceiveMessages/SendMessages call; callers
+// learn how many were processed and can simply issue another call for the remainder.
+#define MaxBatchedMessageCount 64
+
+#if HAVE_RECVMMSG || HAVE_SENDMMSG
+static int32_t ValidateMessageHeaders(const MessageHeader* messageHeaders, int32_t messageCount)
+{
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 || messageHeaders[i].IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    return Error_SUCCESS;
+}
+#endif
+
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* messagesReceived)
+{
+    if (messageHeaders == NULL || received == NULL || messagesReceived == NULL || messageCount <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesReceived = 0;
+
+#if HAVE_RECVMMSG
+    int32_t err = ValidateMessageHeaders(messageHeaders, messageCount);
+    if (err != Error_SUCCESS)
+    {
+        return err;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MaxBatchedMessageCount];
+    unsigned int count = (unsigned int)Min(messageCount, MaxBatchedMessageCount);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    // MSG_WAITFORONE: block (when the socket is blocking) only until the first message arrives and
+    // return whatever is already queued after it rather than waiting to fill the whole batch.
+    int res;
+    while ((res = recvmmsg(fd, headers, count, socketFlags | MSG_WAITFORONE, NULL)) < 0 && errno == EINTR);
+
+    if (res == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        UpdateMessageHeaderFromMsghdr(&messageHeaders[i], &headers[i].msg_hdr);
+        received[i] = headers[i].msg_len;
+    }
+
+    *messagesReceived = res;
+    return Error_SUCCESS;
+#else
+    // Without recvmmsg, receive messages one at a time. The first failure is reported to the caller;
+    // a failure after some messages were received (typically EAGAIN) just ends the batch. Only the
+    // first receive may block, matching the MSG_WAITFORONE behavior of the recvmmsg path.
+    int32_t count = Min(messageCount, MaxBatchedMessageCount);
+    for (int32_t i = 0; i < count; i++)
+    {
+        int32_t err = SystemNative_ReceiveMessage(socket, &messageHeaders[i], i == 0 ? flags : (flags | SocketFlags_MSG_DONTWAIT), &received[i]);
+        if (err != Error_SUCCESS)
+        {
+            return i == 0 ? err : Error_SUCCESS;
+        }
+
+        *messagesReceived = i + 1;
+    }
+
+    return Error_SUCCESS;
+#endif
+}
+
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* messagesSent)
+{
+    if (messageHeaders == NULL || sent == NULL || messagesSent == NULL || messageCount <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesSent = 0;
+
+#if HAVE_SENDMMSG
+    int32_t err = ValidateMessageHeaders(messageHeaders, messageCount);
+    if (err != Error_SUCCESS)
+    {
+        return err;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MaxBatchedMessageCount];
+    unsigned int count = (unsigned int)Min(messageCount, MaxBatchedMessageCount);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = sendmmsg(fd, headers, count, socketFlags)) < 0 && errno == EINTR);
+
+    if (res == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        sent[i] = headers[i].msg_len;
+    }
+
+    *messagesSent = res;
+    return Error_SUCCESS;
+#else
+    // Without sendmmsg, send messages one at a time. The first failure is reported to the caller;
+    // a failure after some messages were sent (typically EAGAIN) just ends the batch. Only the
+    // first send may block so a full send buffer cannot stall a partially sent batch.
+    int32_t count = Min(messageCount, MaxBatchedMessageCount);
+    for (int32_t i = 0; i < count; i++)
+    {
+        int32_t err = SystemNative_SendMessage(socket, &messageHeaders[i], i == 0 ? flags : (flags | SocketFlags_MSG_DONTWAIT), &sent[i]);
+        if (err != Error_SUCCESS)
+        {
+            return i == 0 ? err : Error_SUCCESS;
+        }
+
+        *messagesSent = i + 1;
+    }
+
+    return Error_SUCCESS;
+#endif
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -1860,6 +2122,12 @@ static bool TryGetPlatformSocketOption(int32_t socketOptionLevel, int32_t socket
 
                 // case SocketOptionName_SO_MAXCONN:
 
+#ifdef SO_ZEROCOPY
+                case SocketOptionName_SO_ZEROCOPY:
+                    *optName = SO_ZEROCOPY;
+                    return true;
+#endif
+
                 default:
                     return false;
             }
@@ -2038,6 +2306,18 @@ static bool TryGetPlatformSocketOption(int32_t socketOptionLevel, int32_t socket
 
                 // case SocketOptionName_SO_UDP_UPDATECONNECTCONTEXT:
 
+#if defined(UDP_SEGMENT)
+                case SocketOptionName_SO_UDP_SEGMENT:
+                    *optName = UDP_SEGMENT;
+                    return true;
+#endif
+
+#if defined(UDP_GRO)
+                case SocketOptionName_SO_UDP_GRO:
+                    *optName = UDP_GRO;
+                    return true;
+#endif
+
                 default:
                     return false;
             }
@@ -2846,26 +3126,27 @@ static void ConvertEventEPollToSocketAsync(SocketEvent* sae, struct epoll_event*
     sae->Events = GetSocketEvents(events);
 }
 
-static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count)
+static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count, int32_t millisecondsTimeout)
 {
     assert(buffer != NULL);
     assert(count != NULL);
     assert(*count >= 0);
+    assert(millisecondsTimeout >= -1);
 
     struct epoll_event* events = (struct epoll_event*)buffer;
     int numEvents;
-    while ((numEvents = epoll_wait(port, events, *count, -1)) < 0 && errno == EINTR);
+    while ((numEvents = epoll_wait(port, events, *count, millisecondsTimeout)) < 0 && errno == EINTR);
     if (numEvents == -1)
     {
         *count = 0;
         return SystemNative_ConvertErrorPlatformToPal(errno);
     }
 
-    // We should never see 0 events. Given an infinite timeout, epoll_wait will never return
-    // 0 events even if there are no file descriptors registered with the epoll fd. In
-    // that case, the wait will block until a file descriptor is added and an event occurs
+    // We should never see 0 events with an infinite timeout. In that case epoll_wait will never
+    // return 0 events even if there are no file descriptors registered with the epoll fd.
+    // Instead, the wait will block until a file descriptor is added and an event occurs
     // on the added file descriptor.
-    assert(numEvents != 0);
+    assert(numEvents != 0 || millisecondsTimeout != -1);
     assert(numEvents <= *count);
 
     if (sizeof(struct epoll_event) < sizeof(SocketEvent))
@@ -3019,26 +3300,36 @@ static int32_t TryChangeSocketEventRegistrationInner(
     return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
-static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count)
+static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count, int32_t millisecondsTimeout)
 {
     assert(buffer != NULL);
     assert(count != NULL);
     assert(*count >= 0);
+    assert(millisecondsTimeout >= -1);
+
+    struct timespec timeout;
+    struct timespec* timeoutPtr = NULL;
+    if (millisecondsTimeout != -1)
+    {
+        timeout.tv_sec = millisecondsTimeout / 1000;
+        timeout.tv_nsec = (millisecondsTimeout % 1000) * 1000000;
+        timeoutPtr = &timeout;
+    }
 
     struct kevent* events = (struct kevent*)buffer;
     int numEvents;
-    while ((numEvents = kevent(port, NULL, 0, events, GetKeventNchanges(*count), NULL)) < 0 && errno == EINTR);
+    while ((numEvents = kevent(port, NULL, 0, events, GetKeventNchanges(*count), timeoutPtr)) < 0 && errno == EINTR);
     if (numEvents == -1)
     {
         *count = -1;
         return SystemNative_ConvertErrorPlatformToPal(errno);
     }
 
-    // We should never see 0 events. Given an infinite timeout, kevent will never return
-    // 0 events even if there are no file descriptors registered with the kqueue fd. In
-    // that case, the wait will block until a file descriptor is added and an event occurs
+    // We should never see 0 events with an infinite timeout. In that case kevent will never
+    // return 0 events even if there are no file descriptors registered with the kqueue fd.
+    // Instead, the wait will block until a file descriptor is added and an event occurs
     // on the added file descriptor.
-    assert(numEvents != 0);
+    assert(numEvents != 0 || millisecondsTimeout != -1);
     assert(numEvents <= *count);
 
     for (int i = 0; i < numEvents; i++)
@@ -3075,7 +3366,7 @@ uintptr_t data)
 {
     return Error_ENOSYS;
 }
-static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count)
+static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count, int32_t millisecondsTimeout)
 {
     return Error_ENOSYS;
 }
@@ -3123,10 +3414,8 @@ int32_t SystemNative_FreeSocketEventBuffer(SocketEvent* buffer)
     return Error_SUCCESS;
 }
 
-int32_t
-SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data)
+static int32_t TryChangeSocketEventRegistrationCore(int portFd, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data)
 {
-    int portFd = ToFileDescriptor(port);
     int socketFd = ToFileDescriptor(socket);
 
     const int32_t SupportedEvents = SocketEvents_SA_READ | SocketEvents_SA_WRITE | SocketEvents_SA_READCLOSE | SocketEvents_SA_CLOSE | SocketEvents_SA_ERROR;
@@ -3145,16 +3434,58 @@ SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, in
         portFd, socketFd, (SocketEvents)currentEvents, (SocketEvents)newEvents, data);
 }
 
+int32_t
+SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data)
+{
+    return TryChangeSocketEventRegistrationCore(ToFileDescriptor(port), socket, currentEvents, newEvents, data);
+}
+
+int32_t SystemNative_TryChangeSocketEventRegistrations(intptr_t port, SocketEventRegistration* registrations, int32_t count, int32_t* applied)
+{
+    if (registrations == NULL || applied == NULL || count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    int portFd = ToFileDescriptor(port);
+
+    // Apply the changes queued by an event-loop iteration in a single transition. Changes are applied
+    // in order and the first failure stops the batch; the caller learns how many were applied.
+    for (int32_t i = 0; i < count; i++)
+    {
+        int32_t err = TryChangeSocketEventRegistrationCore(
+            portFd, registrations[i].Socket, registrations[i].CurrentEvents, registrations[i].NewEvents, registrations[i].Data);
+        if (err != Error_SUCCESS)
+        {
+            *applied = i;
+            return err;
+        }
+    }
+
+    *applied = count;
+    return Error_SUCCESS;
+}
+
 int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count)
+{
+    return SystemNative_WaitForSocketEventsWithTimeout(port, buffer, count, -1);
+}
+
+int32_t SystemNative_WaitForSocketEventsWithTimeout(intptr_t port, SocketEvent* buffer, int32_t* count, int32_t millisecondsTimeout)
 {
     if (buffer == NULL || count == NULL || *count < 0)
     {
         return Error_EFAULT;
     }
 
+    if (millisecondsTimeout < -1)
+    {
+        return Error_EINVAL;
+    }
+
     int fd = ToFileDescriptor(port);
 
-    return WaitForSocketEventsInner(fd, buffer, count);
+    return WaitForSocketEventsInner(fd, buffer, count, millisecondsTimeout);
 }
 
 int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void)
@@ -155,6 +155,7 @@ typedef enum
     SocketOptionName_SO_ERROR = 0x1007,
     SocketOptionName_SO_TYPE = 0x1008,
     // SocketOptionName_SO_MAXCONN = 0x7fffffff,
+    SocketOptionName_SO_ZEROCOPY = 0x4001, // not part of System.Net.SocketOptionName; enables MSG_ZEROCOPY sends on Linux
 
     // Names for level SocketOptionLevel_SOL_IP
     SocketOptionName_SO_IP_OPTIONS = 1,
@@ -191,6 +192,10 @@ typedef enum
     // SocketOptionName_SO_UDP_CHECKSUM_COVERAGE = 20,
     // SocketOptionName_SO_UDP_UPDATEACCEPTCONTEXT = 0x700b,
     // SocketOptionName_SO_UDP_UPDATECONNECTCONTEXT = 0x7010,
+
+    // Linux UDP segmentation offloads; not part of System.Net.SocketOptionName.
+    SocketOptionName_SO_UDP_SEGMENT = 103, // UDP_SEGMENT: GSO segment size applied to each send
+    SocketOptionName_SO_UDP_GRO = 104,     // UDP_GRO: coalesce received datagrams, reported via control message
 } SocketOptionName;
 
 /*
@@ -209,6 +214,7 @@ typedef enum
     SocketFlags_MSG_CTRUNC = 0x0200,    // SocketFlags.ControlDataTruncated
     SocketFlags_MSG_DONTWAIT = 0x1000,  // used privately by Ping
     SocketFlags_MSG_ERRQUEUE = 0x2000,  // used privately by Ping
+    SocketFlags_MSG_ZEROCOPY = 0x4000,  // used privately for zero-copy sends; requires SO_ZEROCOPY
 } SocketFlags;
 
 /*
@@ -297,6 +303,14 @@ typedef struct
     uint32_t Padding;    // Pad out to 8-byte alignment
 } SocketEvent;
 
+typedef struct
+{
+    intptr_t Socket;       // Socket whose registration changes
+    uintptr_t Data;        // User data for this socket
+    int32_t CurrentEvents; // Events the socket is currently registered for
+    int32_t NewEvents;     // Events the socket should be registered for
+} SocketEventRegistration;
+
 PALEXPORT int32_t SystemNative_GetHostEntryForName(const uint8_t* address, int32_t addressFamily, HostEntry* entry);
 
 PALEXPORT void SystemNative_FreeHostEntry(HostEntry* entry);
@@ -339,6 +353,8 @@ PALEXPORT int32_t SystemNative_GetControlMessageBufferSize(int32_t isIPv4, int32
 
 PALEXPORT int32_t SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isIPv4, IPPacketInformation* packetInfo);
 
+PALEXPORT int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize);
+
 PALEXPORT int32_t SystemNative_GetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
 
 PALEXPORT int32_t SystemNative_SetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
@@ -361,10 +377,18 @@ PALEXPORT int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* me
 
 PALEXPORT int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageHeader);
 
+PALEXPORT int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* rangeStart, uint32_t* rangeEnd, int32_t* copied);
+
 PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent);
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* messagesReceived);
+
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* messagesSent);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -414,8 +438,12 @@ PALEXPORT int32_t SystemNative_FreeSocketEventBuffer(SocketEvent* buffer);
 PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistration(
     intptr_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data);
 
+PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistrations(intptr_t port, SocketEventRegistration* registrations, int32_t count, int32_t* applied);
+
 PALEXPORT int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count);
 
+PALEXPORT int32_t SystemNative_WaitForSocketEventsWithTimeout(intptr_t port, SocketEvent* buffer, int32_t* count, int32_t millisecondsTimeout);
+
 PALEXPORT int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void);
 
 PALEXPORT void SystemNative_GetDomainSocketSizes(int32_t* pathOffset, int32_t* pathSize, int32_t* addressSize);
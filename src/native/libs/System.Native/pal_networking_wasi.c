@@ -125,6 +125,11 @@ SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isI
     return Error_EINVAL;
 }
 
+int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize)
+{
+    return 0;
+}
+
 int32_t SystemNative_GetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option)
 {
     return Error_EINVAL;
@@ -210,6 +215,11 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     return Error_EINVAL;
 }
 
+int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* rangeStart, uint32_t* rangeEnd, int32_t* copied)
+{
+    return Error_EINVAL;
+}
+
 int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
 {
     return Error_EINVAL;
@@ -220,6 +230,18 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return Error_EINVAL;
 }
 
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* messagesReceived)
+{
+    return Error_EINVAL;
+}
+
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* messagesSent)
+{
+    return Error_EINVAL;
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -401,11 +423,21 @@ SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, in
     return Error_EINVAL;
 }
 
+int32_t SystemNative_TryChangeSocketEventRegistrations(intptr_t port, SocketEventRegistration* registrations, int32_t count, int32_t* applied)
+{
+    return Error_EINVAL;
+}
+
 int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count)
 {
     return Error_EINVAL;
 }
 
+int32_t SystemNative_WaitForSocketEventsWithTimeout(intptr_t port, SocketEvent* buffer, int32_t* count, int32_t millisecondsTimeout)
+{
+    return Error_EINVAL;
+}
+
 int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void)
 {
     return 0;
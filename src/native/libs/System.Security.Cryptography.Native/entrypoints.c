@@ -136,6 +136,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDesCbc)
     DllImportEntry(CryptoNative_EvpDesCfb8)
     DllImportEntry(CryptoNative_EvpDesEcb)
+    DllImportEntry(CryptoNative_EvpDigestBatch)
     DllImportEntry(CryptoNative_EvpDigestCurrent)
     DllImportEntry(CryptoNative_EvpDigestCurrentXOF)
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
@@ -222,6 +223,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_GetX509SubjectPublicKeyInfoDerSize)
     DllImportEntry(CryptoNative_GetX509Thumbprint)
     DllImportEntry(CryptoNative_GetX509Version)
+    DllImportEntry(CryptoNative_HmacBatch)
     DllImportEntry(CryptoNative_HmacCopy)
     DllImportEntry(CryptoNative_HmacCreate)
     DllImportEntry(CryptoNative_HmacCurrent)
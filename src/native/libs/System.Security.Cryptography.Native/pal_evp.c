@@ -11,6 +11,10 @@
 #define SUCCESS 1
 
 static const EVP_MD* g_evpFetchMd5 = NULL;
+static const EVP_MD* g_evpFetchSha1 = NULL;
+static const EVP_MD* g_evpFetchSha256 = NULL;
+static const EVP_MD* g_evpFetchSha384 = NULL;
+static const EVP_MD* g_evpFetchSha512 = NULL;
 static pthread_once_t g_evpFetch = PTHREAD_ONCE_INIT;
 
 static void EnsureFetchEvpMdAlgorithms(void)
@@ -25,6 +29,15 @@ static void EnsureFetchEvpMdAlgorithms(void)
         // Try to fetch an MD5 implementation that will work regardless if
         // FIPS is enforced or not.
         g_evpFetchMd5 = EVP_MD_fetch(NULL, "MD5", "-fips");
+
+        // The legacy getters make every EVP_DigestInit_ex fetch implicitly, which takes the
+        // provider store lock. Fetch the common digests once up front and reuse them.
+        g_evpFetchSha1 = EVP_MD_fetch(NULL, "SHA1", NULL);
+        g_evpFetchSha256 = EVP_MD_fetch(NULL, "SHA256", NULL);
+        g_evpFetchSha384 = EVP_MD_fetch(NULL, "SHA384", NULL);
+        g_evpFetchSha512 = EVP_MD_fetch(NULL, "SHA512", NULL);
+
+        ERR_clear_error();
     }
 #endif
 
@@ -34,6 +47,26 @@ static void EnsureFetchEvpMdAlgorithms(void)
     {
         g_evpFetchMd5 = EVP_md5();
     }
+
+    if (g_evpFetchSha1 == NULL)
+    {
+        g_evpFetchSha1 = EVP_sha1();
+    }
+
+    if (g_evpFetchSha256 == NULL)
+    {
+        g_evpFetchSha256 = EVP_sha256();
+    }
+
+    if (g_evpFetchSha384 == NULL)
+    {
+        g_evpFetchSha384 = EVP_sha384();
+    }
+
+    if (g_evpFetchSha512 == NULL)
+    {
+        g_evpFetchSha512 = EVP_sha512();
+    }
 }
 
 EVP_MD_CTX* CryptoNative_EvpMdCtxCreate(const EVP_MD* type)
@@ -232,6 +265,53 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
     return ret;
 }
 
+int32_t CryptoNative_EvpDigestBatch(
+    const EVP_MD* type, const uint8_t** sources, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdSize)
+{
+    ERR_clear_error();
+
+    if (type == NULL || count < 0 || (count > 0 && (sources == NULL || sourceSizes == NULL || md == NULL)) ||
+        mdSize < EVP_MD_get_size(type))
+    {
+        return -1;
+    }
+
+    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = SUCCESS;
+
+    for (int32_t i = 0; i < count && ret == SUCCESS; i++)
+    {
+        if (sourceSizes[i] < 0 || (sources[i] == NULL && sourceSizes[i] != 0))
+        {
+            ret = -1;
+            break;
+        }
+
+        // The context was initialized for the first message by EvpMdCtxCreate; re-initialize it for
+        // the rest rather than creating a new one, which would repeat the allocation.
+        if (i != 0)
+        {
+            ret = EVP_DigestInit_ex(ctx, type, NULL);
+        }
+
+        uint32_t size;
+        if (ret == SUCCESS &&
+            (ret = EVP_DigestUpdate(ctx, sources[i], (size_t)sourceSizes[i])) == SUCCESS)
+        {
+            ret = CryptoNative_EvpDigestFinalEx(ctx, md + (size_t)i * (size_t)mdSize, &size);
+        }
+    }
+
+    CryptoNative_EvpMdCtxDestroy(ctx);
+    return ret;
+}
+
 int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t len)
 {
     ERR_clear_error();
@@ -299,26 +379,26 @@ const EVP_MD* CryptoNative_EvpMd5(void)
 
 const EVP_MD* CryptoNative_EvpSha1(void)
 {
-    // No error queue impact.
-    return EVP_sha1();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha1;
 }
 
 const EVP_MD* CryptoNative_EvpSha256(void)
 {
-    // No error queue impact.
-    return EVP_sha256();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha256;
 }
 
 const EVP_MD* CryptoNative_EvpSha384(void)
 {
-    // No error queue impact.
-    return EVP_sha384();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha384;
 }
 
 const EVP_MD* CryptoNative_EvpSha512(void)
 {
-    // No error queue impact.
-    return EVP_sha512();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha512;
 }
 
 const EVP_MD* CryptoNative_EvpSha3_256(void)
@@ -81,6 +81,18 @@ Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a sin
 */
 PALEXPORT int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize);
 
+/*
+Function:
+EvpDigestBatch
+
+Computes the digests of count independent messages with a single EVP_MD_CTX, writing each digest
+to md at a stride of mdSize bytes. mdSize must be at least the digest size of type.
+
+Returns 1 on success, 0 on failure, and -1 on invalid input.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestBatch(
+    const EVP_MD* type, const uint8_t** sources, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdSize);
+
 /*
 Function:
 EvpDigestXOFOneShot
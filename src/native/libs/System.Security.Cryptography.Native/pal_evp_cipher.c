@@ -4,10 +4,80 @@
 #include "pal_evp_cipher.h"
 
 #include <assert.h>
+#include <pthread.h>
 
 #define SUCCESS 1
 #define KEEP_CURRENT_DIRECTION -1
 
+static const EVP_CIPHER* g_evpFetchAes128Ecb = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Cbc = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Gcm = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Cfb128 = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Cfb8 = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Ccm = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Ecb = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Cbc = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Gcm = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Cfb128 = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Cfb8 = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Ccm = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Ecb = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Cbc = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Gcm = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Cfb128 = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Cfb8 = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Ccm = NULL;
+static pthread_once_t g_evpCipherFetch = PTHREAD_ONCE_INIT;
+
+static const EVP_CIPHER* FetchCipher(const char* algorithm, const EVP_CIPHER* implicitCipher)
+{
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(EVP_CIPHER_fetch))
+    {
+        const EVP_CIPHER* cipher = EVP_CIPHER_fetch(NULL, algorithm, NULL);
+        if (cipher != NULL)
+        {
+            return cipher;
+        }
+    }
+#else
+    (void)algorithm;
+#endif
+
+    // If EVP_CIPHER_fetch is unavailable or failed, use the implicit loader.
+    return implicitCipher;
+}
+
+static void EnsureFetchEvpCipherAlgorithms(void)
+{
+    // This is called from a pthread_once - this method should not be called directly.
+
+    // The legacy getters make every EVP_CipherInit_ex fetch implicitly, which takes the provider
+    // store lock. Fetch the AES ciphers once up front and reuse them; they are never freed.
+    ERR_clear_error();
+
+    g_evpFetchAes128Ecb = FetchCipher("AES-128-ECB", EVP_aes_128_ecb());
+    g_evpFetchAes128Cbc = FetchCipher("AES-128-CBC", EVP_aes_128_cbc());
+    g_evpFetchAes128Gcm = FetchCipher("AES-128-GCM", EVP_aes_128_gcm());
+    g_evpFetchAes128Cfb128 = FetchCipher("AES-128-CFB", EVP_aes_128_cfb128());
+    g_evpFetchAes128Cfb8 = FetchCipher("AES-128-CFB8", EVP_aes_128_cfb8());
+    g_evpFetchAes128Ccm = FetchCipher("AES-128-CCM", EVP_aes_128_ccm());
+    g_evpFetchAes192Ecb = FetchCipher("AES-192-ECB", EVP_aes_192_ecb());
+    g_evpFetchAes192Cbc = FetchCipher("AES-192-CBC", EVP_aes_192_cbc());
+    g_evpFetchAes192Gcm = FetchCipher("AES-192-GCM", EVP_aes_192_gcm());
+    g_evpFetchAes192Cfb128 = FetchCipher("AES-192-CFB", EVP_aes_192_cfb128());
+    g_evpFetchAes192Cfb8 = FetchCipher("AES-192-CFB8", EVP_aes_192_cfb8());
+    g_evpFetchAes192Ccm = FetchCipher("AES-192-CCM", EVP_aes_192_ccm());
+    g_evpFetchAes256Ecb = FetchCipher("AES-256-ECB", EVP_aes_256_ecb());
+    g_evpFetchAes256Cbc = FetchCipher("AES-256-CBC", EVP_aes_256_cbc());
+    g_evpFetchAes256Gcm = FetchCipher("AES-256-GCM", EVP_aes_256_gcm());
+    g_evpFetchAes256Cfb128 = FetchCipher("AES-256-CFB", EVP_aes_256_cfb128());
+    g_evpFetchAes256Cfb8 = FetchCipher("AES-256-CFB8", EVP_aes_256_cfb8());
+    g_evpFetchAes256Ccm = FetchCipher("AES-256-CCM", EVP_aes_256_ccm());
+
+    ERR_clear_error();
+}
+
 EVP_CIPHER_CTX*
 CryptoNative_EvpCipherCreate2(const EVP_CIPHER* type, uint8_t* key, int32_t keyLength, unsigned char* iv, int32_t enc)
 {
@@ -235,110 +305,110 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_ecb();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Ecb;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Cbc(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_cbc();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Cbc;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Gcm(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_gcm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Gcm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Cfb128(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_cfb128();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Cfb128;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Cfb8(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_cfb8();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Cfb8;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Ccm(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_ccm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Ccm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Ecb(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_ecb();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Ecb;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Cfb128(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_cfb128();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Cfb128;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Cfb8(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_cfb8();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Cfb8;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Cbc(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_cbc();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Cbc;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Gcm(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_gcm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Gcm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Ccm(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_ccm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Ccm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Ecb(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_ecb();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Ecb;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Cfb128(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_cfb128();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Cfb128;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Cfb8(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_cfb8();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Cfb8;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Cbc(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_cbc();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Cbc;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Gcm(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_gcm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Gcm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Ccm(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_ccm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Ccm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpDesEcb(void)
@@ -184,3 +184,54 @@ int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
 
     return result == NULL ? 0 : 1;
 }
+
+int32_t CryptoNative_HmacBatch(const EVP_MD* type,
+                               const uint8_t* key,
+                               int32_t keySize,
+                               const uint8_t** sources,
+                               const int32_t* sourceSizes,
+                               int32_t count,
+                               uint8_t* md,
+                               int32_t mdSize)
+{
+    assert(type != NULL);
+    assert(key != NULL || keySize == 0);
+
+    ERR_clear_error();
+
+    if (type == NULL || keySize < 0 || count < 0 || (count > 0 && (sources == NULL || sourceSizes == NULL || md == NULL)) ||
+        mdSize < EVP_MD_get_size(type))
+    {
+        return -1;
+    }
+
+    HMAC_CTX* ctx = CryptoNative_HmacCreate(key, keySize, type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = 1;
+
+    for (int32_t i = 0; i < count && ret == 1; i++)
+    {
+        if (sourceSizes[i] < 0 || (sources[i] == NULL && sourceSizes[i] != 0))
+        {
+            ret = -1;
+            break;
+        }
+
+        // Resetting reuses the keyed inner/outer pad state instead of deriving it again per message.
+        int32_t len = mdSize;
+        if ((i != 0 && !CryptoNative_HmacReset(ctx)) ||
+            !CryptoNative_HmacUpdate(ctx, sources[i], sourceSizes[i]) ||
+            !CryptoNative_HmacFinal(ctx, md + (size_t)i * (size_t)mdSize, &len))
+        {
+            ret = 0;
+        }
+    }
+
+    CryptoNative_HmacDestroy(ctx);
+    return ret;
+}
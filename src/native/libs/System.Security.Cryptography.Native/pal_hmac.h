@@ -82,6 +82,21 @@ PALEXPORT int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
                                            uint8_t* md,
                                            int32_t* mdSize);
 
+/**
+ * Computes the HMACs of count independent messages under the same key, keying a single HMAC_CTX
+ * once and resetting it between messages. Each HMAC is written to md at a stride of mdSize bytes,
+ * which must be at least the digest size of type.
+ * Returns -1 on invalid input, 0 on failure, and 1 on success.
+ */
+PALEXPORT int32_t CryptoNative_HmacBatch(const EVP_MD* type,
+                                         const uint8_t* key,
+                                         int32_t keySize,
+                                         const uint8_t** sources,
+                                         const int32_t* sourceSizes,
+                                         int32_t count,
+                                         uint8_t* md,
+                                         int32_t mdSize);
+
 /**
  * Clones the context of the HMAC.
  * Returns NULL on failure.
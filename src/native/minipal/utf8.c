@@ -8,6 +8,16 @@
 #include <string.h>
 #include <assert.h>
 
+#if !BIGENDIAN
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HAVE_VECTOR_ASCII 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define HAVE_VECTOR_ASCII 1
+#endif
+#endif
+
 #define HIGH_SURROGATE_START 0xd800
 #define HIGH_SURROGATE_END 0xdbff
 #define LOW_SURROGATE_START 0xdc00
@@ -329,6 +339,52 @@ typedef struct
 #define SupplimentarySeq (1 << 28)
 #define ThreeByteSeq (1 << 27)
 
+#if HAVE_VECTOR_ASCII
+// Widens 16 bytes into 16 UTF-16 code units if they are all ASCII. Nothing is written otherwise.
+static bool TryWidenAscii16(const unsigned char* src, CHAR16_T* dst)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    uint8x16_t bytes = vld1q_u8(src);
+    if (vmaxvq_u8(bytes) > 0x7F)
+        return false;
+
+    vst1q_u16((uint16_t*)dst, vmovl_u8(vget_low_u8(bytes)));
+    vst1q_u16((uint16_t*)dst + 8, vmovl_high_u8(bytes));
+#else
+    __m128i bytes = _mm_loadu_si128((const __m128i*)src);
+    if (_mm_movemask_epi8(bytes) != 0)
+        return false;
+
+    __m128i zero = _mm_setzero_si128();
+    _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi8(bytes, zero));
+    _mm_storeu_si128((__m128i*)(dst + 8), _mm_unpackhi_epi8(bytes, zero));
+#endif
+    return true;
+}
+
+// Narrows 16 UTF-16 code units into 16 bytes if they are all ASCII. Nothing is written otherwise.
+static bool TryNarrowAscii16(const CHAR16_T* src, unsigned char* dst)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    uint16x8_t lower = vld1q_u16((const uint16_t*)src);
+    uint16x8_t upper = vld1q_u16((const uint16_t*)src + 8);
+    if (vmaxvq_u16(vorrq_u16(lower, upper)) > 0x7F)
+        return false;
+
+    vst1q_u8(dst, vcombine_u8(vmovn_u16(lower), vmovn_u16(upper)));
+#else
+    __m128i lower = _mm_loadu_si128((const __m128i*)src);
+    __m128i upper = _mm_loadu_si128((const __m128i*)(src + 8));
+    __m128i nonAscii = _mm_and_si128(_mm_or_si128(lower, upper), _mm_set1_epi16((short)0xFF80));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xFFFF)
+        return false;
+
+    _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lower, upper));
+#endif
+    return true;
+}
+#endif // HAVE_VECTOR_ASCII
+
 static bool InRange(int c, int begin, int end)
 {
     return begin <= c && c <= end;
@@ -1077,6 +1133,24 @@ static size_t GetChars(UTF8Encoding* self, unsigned char* bytes, size_t byteCoun
                 }
             }
 
+#if HAVE_VECTOR_ASCII
+            // Run 16 characters at a time while the input stays ASCII. When a non-ASCII byte
+            // shows up, the 8 character loop below locates it.
+            while (pTarget + 16 <= pStop)
+            {
+                if (pTarget + 16 > pAllocatedBufferEnd)
+                {
+                    errno = MINIPAL_ERROR_INSUFFICIENT_BUFFER;
+                    return 0;
+                }
+
+                if (!TryWidenAscii16(pSrc, pTarget)) break;
+
+                pSrc += 16;
+                pTarget += 16;
+            }
+#endif
+
             // Run 8 characters at a time!
             while (pTarget < pStop)
             {
@@ -1582,6 +1656,24 @@ static size_t GetBytes(UTF8Encoding* self, CHAR16_T* chars, size_t charCount, un
                 ENSURE_BUFFER_INC
             }
 
+#if HAVE_VECTOR_ASCII
+            // Run 16 characters at a time while the input stays ASCII. When a non-ASCII character
+            // shows up, the 4 character loop below locates it.
+            while (pSrc + 16 <= pStop)
+            {
+                if (pTarget + 16 > pAllocatedBufferEnd)
+                {
+                    errno = MINIPAL_ERROR_INSUFFICIENT_BUFFER;
+                    return 0;
+                }
+
+                if (!TryNarrowAscii16(pSrc, pTarget)) break;
+
+                pSrc += 16;
+                pTarget += 16;
+            }
+#endif
+
             // Run 4 characters at a time!
             while (pSrc < pStop)
             {
@@ -0,0 +1,80 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using Xunit;
+
+// Runs hot counted loops with runtime trip counts often enough for them to be
+// rejitted with profile data, so that JitPartialUnroll duplicates them, and checks
+// the results for trip counts that are and aren't multiples of the unroll factor.
+public class PartialUnroll
+{
+    private const int Rounds = 40;
+
+    private static readonly int[] s_tripCounts = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 63, 64, 65, 66, 67, 1000, 1001, 1002, 1003 };
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long Sum(int[] values, int count)
+    {
+        long sum = 0;
+        for (int i = 0; i < count; i++)
+        {
+            sum += values[i];
+        }
+
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Fill(int[] values, int start, int end)
+    {
+        for (int i = start; i < end; i++)
+        {
+            values[i] = i * 3 + 1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int CountDown(int count)
+    {
+        int iterations = 0;
+        for (int i = count; i > 0; i--)
+        {
+            iterations++;
+        }
+
+        return iterations;
+    }
+
+    [Fact]
+    public static void OddAndEvenTripCounts()
+    {
+        int[] values = new int[1024];
+        for (int i = 0; i < values.Length; i++)
+        {
+            values[i] = i + 1;
+        }
+
+        for (int round = 0; round < Rounds; round++)
+        {
+            foreach (int count in s_tripCounts)
+            {
+                Assert.Equal((long)count * (count + 1) / 2, Sum(values, count));
+                Assert.Equal(count, CountDown(count));
+
+                int[] filled = new int[count + 2];
+                Fill(filled, 1, count + 1);
+                Assert.Equal(0, filled[0]);
+                for (int i = 1; i <= count; i++)
+                {
+                    Assert.Equal(i * 3 + 1, filled[i]);
+                }
+                Assert.Equal(0, filled[count + 1]);
+            }
+
+            Thread.Sleep(10);
+        }
+    }
+}
@@ -0,0 +1,112 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Resolves return addresses at the start, in the middle and at the end of a method
+// whose code spans many nibble map DWORDs (256 bytes of code each). Addresses near the
+// start share a DWORD with the method header nibble; addresses further in land in DWORDs
+// that hold a pointer to the start of the method.
+public class LargeMethodLookup
+{
+    private const int ProbesPerBlock = 8;
+    private const int BlockCount = 16;
+    private const int ProbeCount = ProbesPerBlock * BlockCount;
+
+    private static readonly MethodBase s_largeMethod =
+        typeof(LargeMethodLookup).GetMethod(nameof(LargeMethod), BindingFlags.NonPublic | BindingFlags.Static);
+
+    private static int s_throwAt = -1;
+    private static int s_probesSeen;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long Probe(long acc, int id)
+    {
+        MethodBase caller = new StackFrame(1, false).GetMethod();
+        if (caller != s_largeMethod)
+        {
+            throw new Exception($"Probe {id} resolved its caller to {caller?.Name ?? "<null>"}");
+        }
+
+        s_probesSeen++;
+
+        if (id == s_throwAt)
+        {
+            throw new InvalidOperationException(id.ToString());
+        }
+
+        return acc * 31 + id;
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static long Block(long acc, int first)
+    {
+        acc = Probe(acc, first + 0);
+        acc = Probe(acc, first + 1);
+        acc = Probe(acc, first + 2);
+        acc = Probe(acc, first + 3);
+        acc = Probe(acc, first + 4);
+        acc = Probe(acc, first + 5);
+        acc = Probe(acc, first + 6);
+        acc = Probe(acc, first + 7);
+        return acc;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long LargeMethod(long acc)
+    {
+        acc = Block(acc, 0 * ProbesPerBlock);
+        acc = Block(acc, 1 * ProbesPerBlock);
+        acc = Block(acc, 2 * ProbesPerBlock);
+        acc = Block(acc, 3 * ProbesPerBlock);
+        acc = Block(acc, 4 * ProbesPerBlock);
+        acc = Block(acc, 5 * ProbesPerBlock);
+        acc = Block(acc, 6 * ProbesPerBlock);
+        acc = Block(acc, 7 * ProbesPerBlock);
+        acc = Block(acc, 8 * ProbesPerBlock);
+        acc = Block(acc, 9 * ProbesPerBlock);
+        acc = Block(acc, 10 * ProbesPerBlock);
+        acc = Block(acc, 11 * ProbesPerBlock);
+        acc = Block(acc, 12 * ProbesPerBlock);
+        acc = Block(acc, 13 * ProbesPerBlock);
+        acc = Block(acc, 14 * ProbesPerBlock);
+        acc = Block(acc, 15 * ProbesPerBlock);
+        return acc;
+    }
+
+    [Fact]
+    public static void StackWalkResolvesEveryCallSite()
+    {
+        s_throwAt = -1;
+        s_probesSeen = 0;
+        LargeMethod(1);
+        Assert.Equal(ProbeCount, s_probesSeen);
+    }
+
+    [Theory]
+    [InlineData(0)]
+    [InlineData(1)]
+    [InlineData(ProbeCount / 2)]
+    [InlineData(ProbeCount - 2)]
+    [InlineData(ProbeCount - 1)]
+    public static void ExceptionUnwindsThroughCallSite(int id)
+    {
+        s_throwAt = id;
+        s_probesSeen = 0;
+        try
+        {
+            InvalidOperationException ex = Assert.Throws<InvalidOperationException>(() => LargeMethod(1));
+            Assert.Equal(id.ToString(), ex.Message);
+            Assert.Equal(s_largeMethod, new StackTrace(ex, false).GetFrame(1).GetMethod());
+            Assert.Equal(id + 1, s_probesSeen);
+        }
+        finally
+        {
+            s_throwAt = -1;
+        }
+    }
+}